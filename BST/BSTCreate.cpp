@@ -1,5 +1,5 @@
 #include<iostream>
-#include<queue>
+#include "../Queue/RingQueue.h"
 #include <vector>
 using namespace std;
 
@@ -15,10 +15,12 @@ class Node{
     }
 };
 
-void levelOrderTraversal(Node* root){
+// q is owned by the caller and cleared here, so a queue passed to every
+// traversal keeps the capacity the widest level needed
+void levelOrderTraversal(Node* root,RingQueue<Node*> &q){
     if(root == NULL) return;
 
-    queue<Node*> q;
+    q.clear();
     q.push(root);
     q.push(NULL);
 
@@ -44,12 +46,12 @@ void levelOrderTraversal(Node* root){
     }
 }
 
-vector<vector<int>> LOT(Node* root){
+vector<vector<int>> LOT(Node* root,RingQueue<Node*> &q){
     vector<vector<int>> ans;
 
     if(root == NULL) return ans;
 
-    queue<Node*> q;
+    q.clear();
     q.push(root);
 
     while(!q.empty()){
@@ -163,19 +165,20 @@ Node* deleteFromBST(Node* root, int val){
 int main(){
 
     Node* root = NULL;
+    RingQueue<Node*> bfsQueue;     // shared by every traversal below
 
     cout<<"Enter data to create BST (-1 to stop):"<<endl;
     takeInput(root);
 
     cout<<"\nLevel Order Traversal:\n";
-    levelOrderTraversal(root);
+    levelOrderTraversal(root,bfsQueue);
 
 
     deleteFromBST(root,10);
 
     cout<<"Deleting "<<endl;
     cout<<"\nLOT (vector output):\n";
-    vector<vector<int>> result = LOT(root);
+    vector<vector<int>> result = LOT(root,bfsQueue);
 
     for(auto level : result){
         for(auto val : level){
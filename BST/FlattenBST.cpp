@@ -1,3 +1,4 @@
+#include "TreeToVine.h"
 /*
 class Node{
 public:
@@ -15,35 +16,13 @@ public:
 
 class Solution {
   public:
-    void inorder(Node* root,vector<int> &ans){
-        if(root==NULL) return;
-        
-        inorder(root->left,ans);
-        ans.push_back(root->data);
-        inorder(root->right,ans);
-    }
+    // relink in place: the sorted right chain is the flattened list
     Node *flattenBST(Node *root) {
         // code here
-        vector<int> ans;
-        inorder(root,ans);
-        
-        int n = ans.size();
-        
-        Node* newRoot = new Node(ans[0]);
-        
-        Node* curr = newRoot;
-        
-        for(int i=1;i<n;i++){
-            Node* temp = new Node(ans[i]);
-            
-            curr->left = NULL;
-            curr->right = temp;
-            curr = temp;
-        }
-        
-        curr->left = NULL;
-        curr->right = NULL;
+        Node pseudoRoot(0);
+        pseudoRoot.right = root;
         
-        return newRoot;
+        treeToVine(&pseudoRoot);
+        return pseudoRoot.right;
     }
 };
\ No newline at end of file
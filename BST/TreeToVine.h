@@ -0,0 +1,34 @@
+#ifndef TREE_TO_VINE_H
+#define TREE_TO_VINE_H
+
+#include <cstddef>
+
+// First half of Day-Stout-Warren: right-rotates every left child into the
+// chain hanging off pseudoRoot->right, so the nodes end up linked through
+// right in sorted order with no left children. In place, no allocation.
+// Returns the number of nodes. Node needs left and right pointers.
+template<typename Node>
+int treeToVine(Node* pseudoRoot){
+    Node* tail = pseudoRoot;
+    Node* rest = tail->right;
+    int size = 0;
+
+    while(rest != NULL){
+        if(rest->left == NULL){
+            tail = rest;
+            rest = rest->right;
+            size++;
+        }
+        else{
+            // right rotation at rest
+            Node* temp = rest->left;
+            rest->left = temp->right;
+            temp->right = rest;
+            rest = temp;
+            tail->right = temp;
+        }
+    }
+    return size;
+}
+
+#endif
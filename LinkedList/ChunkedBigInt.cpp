@@ -0,0 +1,546 @@
+#include<iostream>
+#include<vector>
+#include<string>
+#include<algorithm>
+#include<cstdint>
+#include<cstdlib>
+#include<chrono>
+#include<random>
+using namespace std;
+
+struct ListNode {
+    int val;
+    ListNode *next;
+    ListNode() : val(0), next(nullptr) {}
+    ListNode(int x) : val(x), next(nullptr) {}
+    ListNode(int x, ListNode *next) : val(x), next(next) {}
+};
+
+#include "AddTwoNumber.cpp"
+
+// Signed big integer stored as a singly linked list of blocks, each block
+// carrying up to LIMBS base-1e9 limbs (9 decimal digits each), least
+// significant first like the digit lists of AddTwoNumber.cpp. A block is
+// 128 bytes for 261 digits, against one 16-byte node (plus the malloc
+// header) and one cache miss per digit in the digit list.
+// add/subtract/compare stream over the blocks; multiply copies both
+// operands into flat limb arrays and goes schoolbook below
+// KARATSUBA_THRESHOLD limbs, Karatsuba above.
+
+const uint32_t BASE = 1000000000;
+const int LIMBS = 29;
+const int KARATSUBA_THRESHOLD = 32;
+
+class LimbBlock{
+    public:
+        uint32_t limb[LIMBS];
+        int used;
+        LimbBlock* next;
+
+    LimbBlock(){
+        used = 0;
+        next = NULL;
+    }
+};
+
+class BigInt{
+    public:
+        LimbBlock* head;
+        LimbBlock* tail;
+        int size;           // limbs, 0 for zero
+        bool negative;
+
+    BigInt(){
+        head = tail = NULL;
+        size = 0;
+        negative = false;
+    }
+
+    BigInt(long long x) : BigInt(){
+        negative = x < 0;
+        unsigned long long m = negative ? 0ULL - (unsigned long long)x : x;
+        while(m){
+            push(m % BASE);
+            m /= BASE;
+        }
+    }
+
+    BigInt(const BigInt &other) : BigInt(){
+        for(LimbBlock* b = other.head; b; b = b->next){
+            for(int i=0;i<b->used;i++) push(b->limb[i]);
+        }
+        negative = other.negative;
+    }
+
+    BigInt(BigInt &&other) : BigInt(){
+        swap(other);
+    }
+
+    BigInt& operator=(BigInt other){
+        swap(other);
+        return *this;
+    }
+
+    ~BigInt(){
+        clear();
+    }
+
+    void swap(BigInt &other){
+        std::swap(head,other.head);
+        std::swap(tail,other.tail);
+        std::swap(size,other.size);
+        std::swap(negative,other.negative);
+    }
+
+    bool isZero() const{
+        return size == 0;
+    }
+
+    // decimal, optional leading '-'
+    static BigInt fromString(const string &s){
+        BigInt r;
+        int start = (!s.empty() && s[0] == '-') ? 1 : 0;
+        for(int end = s.size(); end > start; end -= 9){
+            int begin = max(start,end-9);
+            uint32_t limb = 0;
+            for(int i=begin;i<end;i++) limb = limb*10 + (s[i]-'0');
+            r.push(limb);
+        }
+        r.trim();
+        r.negative = start == 1 && !r.isZero();
+        return r;
+    }
+
+    string toString() const{
+        if(isZero()) return "0";
+        vector<uint32_t> limbs = flatten();
+        string s = negative ? "-" : "";
+        s += to_string(limbs.back());
+        for(int i=(int)limbs.size()-2;i>=0;i--){
+            string part = to_string(limbs[i]);
+            s += string(9-part.size(),'0') + part;
+        }
+        return s;
+    }
+
+    // digit list as used by addTwoNumbers: least significant digit first,
+    // non-negative (the sign is dropped)
+    static BigInt fromDigits(ListNode* digits){
+        BigInt r;
+        uint32_t limb = 0;
+        uint32_t scale = 1;
+        for(; digits; digits = digits->next){
+            limb += digits->val * scale;
+            scale *= 10;
+            if(scale == BASE){
+                r.push(limb);
+                limb = 0;
+                scale = 1;
+            }
+        }
+        if(scale > 1) r.push(limb);
+        r.trim();
+        return r;
+    }
+
+    ListNode* toDigits() const{
+        ListNode dummy;
+        ListNode* tail = &dummy;
+        int left = size;
+        for(LimbBlock* b = head; b; b = b->next){
+            for(int i=0;i<b->used;i++){
+                uint32_t limb = b->limb[i];
+                left--;
+                // the top limb stops at its last non-zero digit
+                for(int d=0; d<9 && (left > 0 || limb); d++){
+                    tail->next = new ListNode(limb % 10);
+                    tail = tail->next;
+                    limb /= 10;
+                }
+            }
+        }
+        return dummy.next ? dummy.next : new ListNode(0);
+    }
+
+    // -1, 0 or 1
+    static int compare(const BigInt &a,const BigInt &b){
+        if(a.negative != b.negative) return a.negative ? -1 : 1;
+        int mag = compareMagnitude(a,b);
+        return a.negative ? -mag : mag;
+    }
+
+    friend BigInt operator+(const BigInt &a,const BigInt &b){
+        if(a.negative == b.negative){
+            BigInt r = addMagnitude(a,b);
+            r.negative = a.negative && !r.isZero();
+            return r;
+        }
+        return signedDifference(a,b);
+    }
+
+    friend BigInt operator-(const BigInt &a,const BigInt &b){
+        if(a.negative != b.negative){
+            BigInt r = addMagnitude(a,b);
+            r.negative = a.negative && !r.isZero();
+            return r;
+        }
+        return signedDifference(a,b,true);
+    }
+
+    friend BigInt operator*(const BigInt &a,const BigInt &b){
+        if(a.isZero() || b.isZero()) return BigInt();
+        vector<uint32_t> x = a.flatten();
+        vector<uint32_t> y = b.flatten();
+        vector<uint32_t> product = multiply(x,y,true);
+        BigInt r = fromLimbs(product);
+        r.negative = a.negative != b.negative;
+        return r;
+    }
+
+    friend bool operator==(const BigInt &a,const BigInt &b){ return compare(a,b) == 0; }
+    friend bool operator<(const BigInt &a,const BigInt &b){ return compare(a,b) < 0; }
+
+    // schoolbook only, for checking Karatsuba and for the benchmark
+    static BigInt multiplySchoolbook(const BigInt &a,const BigInt &b){
+        if(a.isZero() || b.isZero()) return BigInt();
+        BigInt r = fromLimbs(multiply(a.flatten(),b.flatten(),false));
+        r.negative = a.negative != b.negative;
+        return r;
+    }
+
+    size_t bytesUsed() const{
+        size_t blocks = 0;
+        for(LimbBlock* b = head; b; b = b->next) blocks++;
+        return blocks * sizeof(LimbBlock);
+    }
+
+    private:
+    void push(uint32_t limb){
+        if(tail == NULL || tail->used == LIMBS){
+            LimbBlock* block = new LimbBlock();
+            if(tail) tail->next = block;
+            else head = block;
+            tail = block;
+        }
+        tail->limb[tail->used++] = limb;
+        size++;
+    }
+
+    void clear(){
+        while(head){
+            LimbBlock* next = head->next;
+            delete head;
+            head = next;
+        }
+        tail = NULL;
+        size = 0;
+    }
+
+    // drops zero limbs at the most significant end
+    void trim(){
+        int keep = 0;
+        int at = 0;
+        for(LimbBlock* b = head; b; b = b->next){
+            for(int i=0;i<b->used;i++){
+                at++;
+                if(b->limb[i]) keep = at;
+            }
+        }
+        if(keep == size) return;
+        if(keep == 0){
+            clear();
+            negative = false;
+            return;
+        }
+
+        LimbBlock* b = head;
+        int before = 0;
+        while(before + b->used < keep){
+            before += b->used;
+            b = b->next;
+        }
+        b->used = keep - before;
+        LimbBlock* rest = b->next;
+        b->next = NULL;
+        tail = b;
+        size = keep;
+        while(rest){
+            LimbBlock* next = rest->next;
+            delete rest;
+            rest = next;
+        }
+    }
+
+    vector<uint32_t> flatten() const{
+        vector<uint32_t> limbs;
+        limbs.reserve(size);
+        for(LimbBlock* b = head; b; b = b->next){
+            limbs.insert(limbs.end(),b->limb,b->limb+b->used);
+        }
+        return limbs;
+    }
+
+    static BigInt fromLimbs(const vector<uint32_t> &limbs){
+        BigInt r;
+        for(uint32_t limb : limbs) r.push(limb);
+        r.trim();
+        return r;
+    }
+
+    // walks the limbs of one number block by block; past the end it reads 0
+    class Cursor{
+        public:
+            LimbBlock* block;
+            int index;
+
+        Cursor(LimbBlock* head){
+            block = head;
+            index = 0;
+        }
+
+        uint32_t next(){
+            if(block == NULL) return 0;
+            uint32_t limb = block->limb[index++];
+            if(index == block->used){
+                block = block->next;
+                index = 0;
+            }
+            return limb;
+        }
+    };
+
+    // one pass from the least significant end; the last difference seen is
+    // the most significant one
+    static int compareMagnitude(const BigInt &a,const BigInt &b){
+        if(a.size != b.size) return a.size < b.size ? -1 : 1;
+        Cursor x(a.head), y(b.head);
+        int result = 0;
+        for(int i=0;i<a.size;i++){
+            uint32_t p = x.next();
+            uint32_t q = y.next();
+            if(p != q) result = p < q ? -1 : 1;
+        }
+        return result;
+    }
+
+    static BigInt addMagnitude(const BigInt &a,const BigInt &b){
+        BigInt r;
+        Cursor x(a.head), y(b.head);
+        uint32_t carry = 0;
+        for(int i=0;i<max(a.size,b.size);i++){
+            uint32_t sum = x.next() + y.next() + carry;
+            carry = sum >= BASE;
+            r.push(carry ? sum - BASE : sum);
+        }
+        if(carry) r.push(carry);
+        return r;
+    }
+
+    // |a| >= |b|
+    static BigInt subtractMagnitude(const BigInt &a,const BigInt &b){
+        BigInt r;
+        Cursor x(a.head), y(b.head);
+        uint32_t borrow = 0;
+        for(int i=0;i<a.size;i++){
+            int64_t diff = (int64_t)x.next() - y.next() - borrow;
+            borrow = diff < 0;
+            r.push(borrow ? diff + BASE : diff);
+        }
+        r.trim();
+        return r;
+    }
+
+    // a + b when the signs differ, or a - b (flip) when they agree: the
+    // smaller magnitude comes off the larger, which keeps its sign
+    static BigInt signedDifference(const BigInt &a,const BigInt &b,bool flip = false){
+        bool bNegative = b.negative != flip;
+        if(compareMagnitude(a,b) >= 0){
+            BigInt r = subtractMagnitude(a,b);
+            r.negative = a.negative && !r.isZero();
+            return r;
+        }
+        BigInt r = subtractMagnitude(b,a);
+        r.negative = bNegative && !r.isZero();
+        return r;
+    }
+
+    // flat limb helpers for multiply; results are not trimmed
+    static vector<uint32_t> addLimbs(const vector<uint32_t> &a,const vector<uint32_t> &b){
+        vector<uint32_t> r(max(a.size(),b.size())+1);
+        uint32_t carry = 0;
+        for(size_t i=0;i<r.size();i++){
+            uint32_t sum = carry;
+            if(i < a.size()) sum += a[i];
+            if(i < b.size()) sum += b[i];
+            carry = sum >= BASE;
+            r[i] = carry ? sum - BASE : sum;
+        }
+        return r;
+    }
+
+    // a -= b, a >= b
+    static void subtractLimbs(vector<uint32_t> &a,const vector<uint32_t> &b){
+        int64_t borrow = 0;
+        for(size_t i=0;i<a.size() && (i < b.size() || borrow);i++){
+            int64_t diff = (int64_t)a[i] - (i < b.size() ? b[i] : 0) - borrow;
+            borrow = diff < 0;
+            a[i] = borrow ? diff + BASE : diff;
+        }
+    }
+
+    static void addLimbsAt(vector<uint32_t> &a,const vector<uint32_t> &b,size_t at){
+        uint32_t carry = 0;
+        for(size_t i=0;at+i<a.size() && (i < b.size() || carry);i++){
+            uint32_t sum = a[at+i] + (i < b.size() ? b[i] : 0) + carry;
+            carry = sum >= BASE;
+            a[at+i] = carry ? sum - BASE : sum;
+        }
+    }
+
+    static vector<uint32_t> schoolbook(const vector<uint32_t> &a,const vector<uint32_t> &b){
+        vector<uint32_t> r(a.size()+b.size());
+        for(size_t i=0;i<a.size();i++){
+            uint64_t carry = 0;
+            for(size_t j=0;j<b.size();j++){
+                uint64_t cur = (uint64_t)a[i]*b[j] + r[i+j] + carry;
+                r[i+j] = cur % BASE;
+                carry = cur / BASE;
+            }
+            r[i+b.size()] = carry;
+        }
+        return r;
+    }
+
+    // a*b = z2*B^2m + ((a0+a1)(b0+b1) - z0 - z2)*B^m + z0
+    static vector<uint32_t> multiply(const vector<uint32_t> &a,const vector<uint32_t> &b,bool karatsuba){
+        if(!karatsuba || min(a.size(),b.size()) < (size_t)KARATSUBA_THRESHOLD){
+            return schoolbook(a,b);
+        }
+        size_t m = max(a.size(),b.size()) / 2;
+        vector<uint32_t> a0(a.begin(),a.begin()+min(m,a.size()));
+        vector<uint32_t> a1(a.begin()+min(m,a.size()),a.end());
+        vector<uint32_t> b0(b.begin(),b.begin()+min(m,b.size()));
+        vector<uint32_t> b1(b.begin()+min(m,b.size()),b.end());
+
+        vector<uint32_t> z0 = multiply(a0,b0,true);
+        vector<uint32_t> z2 = a1.empty() || b1.empty() ? vector<uint32_t>() : multiply(a1,b1,true);
+        vector<uint32_t> z1 = multiply(addLimbs(a0,a1),addLimbs(b0,b1),true);
+        subtractLimbs(z1,z0);
+        subtractLimbs(z1,z2);
+
+        vector<uint32_t> r(a.size()+b.size());
+        addLimbsAt(r,z0,0);
+        addLimbsAt(r,z1,m);
+        addLimbsAt(r,z2,2*m);
+        return r;
+    }
+};
+
+ListNode* digitList(const string &number){
+    ListNode* head = NULL;
+    for(char c : number){
+        head = new ListNode(c-'0',head);
+    }
+    return head;
+}
+
+void deleteDigits(ListNode* head){
+    while(head){
+        ListNode* next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+string randomNumber(int digits,mt19937 &rng){
+    string s(digits,'0');
+    for(char &c : s) c = '0' + rng() % 10;
+    s[0] = '1' + rng() % 9;
+    return s;
+}
+
+int main(){
+
+    BigInt a = BigInt::fromString("123456789012345678901234567890");
+    BigInt b = BigInt::fromString("-987654321098765432109876543210");
+    cout<<"a + b = "<<(a+b).toString()<<endl;
+    cout<<"a - b = "<<(a-b).toString()<<endl;
+    cout<<"a * b = "<<(a*b).toString()<<endl;
+    cout<<"a < b: "<<(a < b)<<", b - b == 0: "<<(b-b == BigInt(0))<<endl;
+
+    ListNode* l1 = digitList("342");
+    ListNode* l2 = digitList("465");
+    BigInt sum = BigInt::fromDigits(l1) + BigInt::fromDigits(l2);
+    ListNode* digits = sum.toDigits();
+    cout<<"342 + 465 as digit list: ";
+    for(ListNode* d = digits; d; d = d->next) cout<<d->val<<" ";
+    cout<<endl;
+    deleteDigits(l1);
+    deleteDigits(l2);
+    deleteDigits(digits);
+
+    mt19937 rng(7);
+    bool ok = true;
+    for(int t=0;t<200;t++){
+        BigInt x = BigInt::fromString((rng() % 2 ? "-" : "") + randomNumber(1 + rng() % 900,rng));
+        BigInt y = BigInt::fromString((rng() % 2 ? "-" : "") + randomNumber(1 + rng() % 900,rng));
+        ok = ok && (x*y == BigInt::multiplySchoolbook(x,y));
+        ok = ok && (x+y-y == x) && (x-y+y == x);
+        ok = ok && (BigInt::fromString((x*y).toString()) == x*y);
+    }
+    cout<<"random checks: "<<(ok ? "ok" : "FAILED")<<endl;
+    cout<<"---------------"<<endl;
+
+    // addition at a million digits: digit list vs limb blocks
+    {
+        int n = 1000000;
+        string x = randomNumber(n,rng);
+        string y = randomNumber(n,rng);
+        ListNode* dx = digitList(x);
+        ListNode* dy = digitList(y);
+        BigInt bx = BigInt::fromString(x);
+        BigInt by = BigInt::fromString(y);
+
+        auto t0 = chrono::high_resolution_clock::now();
+        Solution s;
+        ListNode* digitSum = s.addTwoNumbers(dx,dy);
+        auto t1 = chrono::high_resolution_clock::now();
+        BigInt limbSum = bx + by;
+        auto t2 = chrono::high_resolution_clock::now();
+
+        ListNode* converted = limbSum.toDigits();
+        bool same = true;
+        ListNode* p = digitSum;
+        ListNode* q = converted;
+        while(p && q && same){
+            same = p->val == q->val;
+            p = p->next;
+            q = q->next;
+        }
+        same = same && p == NULL && q == NULL;
+
+        cout<<n<<"-digit add: digit list "<<chrono::duration<double,milli>(t1-t0).count()<<" ms, "
+            <<sizeof(ListNode)<<" B (+ malloc header) per digit | limb blocks "
+            <<chrono::duration<double,milli>(t2-t1).count()<<" ms, "
+            <<(double)limbSum.bytesUsed()/n<<" B per digit"<<(same ? "" : "  WRONG")<<endl;
+
+        deleteDigits(dx);
+        deleteDigits(dy);
+        deleteDigits(digitSum);
+        deleteDigits(converted);
+    }
+
+    int sizes[] = {1000, 10000, 100000};
+    for(int n : sizes){
+        BigInt x = BigInt::fromString(randomNumber(n,rng));
+        BigInt y = BigInt::fromString(randomNumber(n,rng));
+        auto t0 = chrono::high_resolution_clock::now();
+        BigInt slow = BigInt::multiplySchoolbook(x,y);
+        auto t1 = chrono::high_resolution_clock::now();
+        BigInt fast = x*y;
+        auto t2 = chrono::high_resolution_clock::now();
+        cout<<n<<"-digit multiply: schoolbook "<<chrono::duration<double,milli>(t1-t0).count()<<" ms, Karatsuba "
+            <<chrono::duration<double,milli>(t2-t1).count()<<" ms"<<(slow == fast ? "" : "  WRONG")<<endl;
+    }
+    return 0;
+}
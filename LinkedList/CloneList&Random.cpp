@@ -57,4 +57,159 @@ class Solution {
         }
         return cloneHead;
     }
+    
+    // Interleaving clone: every original temporarily points at its copy
+    // through next (copy->next keeps the original's next), so a copy's
+    // random is original->random->next. No map; the copies live in one
+    // block, released with releaseBlock(cloneHead).
+    Node* cloneLinkedListInterleaved(Node* head) {
+        int n = 0;
+        for(Node* temp = head; temp; temp = temp->next){
+            n++;
+        }
+        if(n == 0){
+            return NULL;
+        }
+        Node* block = static_cast<Node*>(::operator new(n * sizeof(Node)));
+        linkCopies(head, block, n);
+        setRandoms(head, block, n);
+        restore(head, block, n);
+        return block;
+    }
+    
+    void linkCopies(Node* from, Node* copies, int count) {
+        for(int i=0;i<count;i++){
+            Node* copy = new(copies+i) Node(from->data);
+            copy->next = from->next;
+            from->next = copy;
+            from = copy->next;
+        }
+    }
+    
+    void setRandoms(Node* from, Node* copies, int count) {
+        for(int i=0;i<count;i++){
+            copies[i].random = from->random ? from->random->next : NULL;
+            from = copies[i].next;
+        }
+    }
+    
+    // copies[count-1] links to copies[count], the next segment's first copy
+    void restore(Node* from, Node* copies, int count) {
+        for(int i=0;i<count;i++){
+            Node* next = copies[i].next;
+            from->next = next;
+            copies[i].next = next ? copies+i+1 : NULL;
+            from = next;
+        }
+    }
+    
+    // Same three passes, each split into contiguous segments run on their
+    // own thread; a pass starts only once every segment finished the last,
+    // since randoms can point into any segment.
+    Node* cloneLinkedListParallel(Node* head, int threads) {
+        vector<Node*> starts;
+        vector<int> offsets;
+        int n = 0;
+        for(Node* temp = head; temp; temp = temp->next){
+            n++;
+        }
+        if(n == 0){
+            return NULL;
+        }
+        threads = max(1, min(threads, n));
+        int chunk = (n + threads - 1) / threads;
+        
+        int i = 0;
+        for(Node* temp = head; temp; temp = temp->next, i++){
+            if(i % chunk == 0){
+                starts.push_back(temp);
+                offsets.push_back(i);
+            }
+        }
+        offsets.push_back(n);
+        
+        Node* block = static_cast<Node*>(::operator new(n * sizeof(Node)));
+        int segments = starts.size();
+        
+        for(int pass=0;pass<3;pass++){
+            vector<thread> pool;
+            for(int s=0;s<segments;s++){
+                pool.push_back(thread([&, s, pass](){
+                    Node* copies = block + offsets[s];
+                    int count = offsets[s+1] - offsets[s];
+                    if(pass == 0) linkCopies(starts[s], copies, count);
+                    else if(pass == 1) setRandoms(starts[s], copies, count);
+                    else restore(starts[s], copies, count);
+                }));
+            }
+            for(thread &t : pool){
+                t.join();
+            }
+        }
+        return block;
+    }
+    
+    // Ownership: cloneLinkedList returns nodes made one by one with new,
+    // freed with delete. Every other list this class returns (interleaved
+    // and parallel clones, compact) is a block: its nodes sit in one
+    // allocation that starts at the head, and it must be freed as a whole
+    // with releaseBlock(head), never node by node.
+    static void releaseBlock(Node* head) {
+        for(Node* temp = head; temp; ){
+            Node* next = temp->next;
+            temp->~Node();
+            temp = next;
+        }
+        ::operator delete(head);
+    }
+    
+    // Moves the list into a new block in list order. Each old node
+    // temporarily points at its copy through next, which gives random the
+    // old->new mapping without a hash map; the old nodes are then freed:
+    // with delete, or with releaseBlock when headIsBlock says the input is
+    // itself a block (say, an earlier compact or a clone above).
+    Node* compact(Node* head, bool headIsBlock = false) {
+        int n = 0;
+        for(Node* temp = head; temp; temp = temp->next){
+            n++;
+        }
+        if(n == 0){
+            return NULL;
+        }
+        
+        Node* block = static_cast<Node*>(::operator new(n * sizeof(Node)));
+        
+        Node* temp = head;
+        for(int i=0;i<n;i++){
+            Node* copy = new(block+i) Node(temp->data);
+            copy->next = temp->next;
+            temp->next = copy;
+            temp = copy->next;
+        }
+        
+        temp = head;
+        for(int i=0;i<n;i++){
+            block[i].random = temp->random ? temp->random->next : NULL;
+            temp = block[i].next;
+        }
+        
+        temp = head;
+        for(int i=0;i<n;i++){
+            Node* next = block[i].next;
+            temp->next = next;
+            block[i].next = (i+1<n) ? block+i+1 : NULL;
+            temp = next;
+        }
+        if(headIsBlock){
+            releaseBlock(head);
+        }
+        else{
+            for(temp = head; temp; ){
+                Node* next = temp->next;
+                delete temp;
+                temp = next;
+            }
+        }
+        return block;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include<iostream>
+#include<vector>
+#include<unordered_map>
+#include<algorithm>
+#include<thread>
+#include<chrono>
+#include<random>
+#include<cstdlib>
+#include<new>
+#include<atomic>
+using namespace std;
+
+// Throughput and peak heap use of the three random-pointer clones:
+// hash map (cloneLinkedList), interleaved and interleaved + parallel.
+
+// atomic: the parallel clone allocates from its worker threads
+atomic<size_t> liveBytes(0);
+atomic<size_t> peakBytes(0);
+
+// every block carries its size in front so delete can subtract it
+void* operator new(size_t size){
+    size_t* p = (size_t*)malloc(size + sizeof(size_t) * 2);
+    if(p == NULL) throw bad_alloc();
+    p[0] = size;
+    size_t live = liveBytes.fetch_add(size) + size;
+    size_t peak = peakBytes.load();
+    while(live > peak && !peakBytes.compare_exchange_weak(peak, live)){
+    }
+    return p + 2;
+}
+
+void operator delete(void* ptr) noexcept{
+    if(ptr == NULL) return;
+    size_t* p = (size_t*)ptr - 2;
+    liveBytes.fetch_sub(p[0]);
+    free(p);
+}
+
+void operator delete(void* ptr,size_t) noexcept{
+    operator delete(ptr);
+}
+
+class Node {
+  public:
+    int data;
+    Node* next;
+    Node* random;
+
+    Node(int x) {
+        data = x;
+        next = NULL;
+        random = NULL;
+    }
+};
+
+#include "CloneList&Random.cpp"
+
+// Same data and random targets, sharing no nodes. The originals hold
+// distinct data (0..n-1), so a random target is identified by its data and
+// the check needs no memory: cheap enough to run at the benchmarked size.
+bool sameShape(Node* a,Node* b){
+    while(a && b){
+        if(a == b || a->data != b->data) return false;
+        if((a->random == NULL) != (b->random == NULL)) return false;
+        if(a->random && (a->random == b->random || a->random->data != b->random->data)) return false;
+        a = a->next;
+        b = b->next;
+    }
+    return a == NULL && b == NULL;
+}
+
+int main(int argc,char** argv){
+
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    int threads = max(1u,thread::hardware_concurrency());
+
+    mt19937 rng(3);
+    vector<Node*> nodes(n);
+    for(int i=0;i<n;i++) nodes[i] = new Node(i);
+    shuffle(nodes.begin(),nodes.end(),rng);
+    for(int i=0;i+1<n;i++) nodes[i]->next = nodes[i+1];
+    for(int i=0;i<n;i++){
+        nodes[i]->random = (rng() % 8) ? nodes[rng() % n] : NULL;
+    }
+    Node* head = nodes[0];
+    vector<Node*>().swap(nodes);
+
+    cout<<n<<" nodes, "<<threads<<" threads"<<endl;
+    Solution s;
+    for(int mode=0;mode<3;mode++){
+        size_t before = liveBytes;
+        peakBytes = liveBytes.load();
+        auto start = chrono::high_resolution_clock::now();
+        Node* clone;
+        if(mode == 0) clone = s.cloneLinkedList(head);
+        else if(mode == 1) clone = s.cloneLinkedListInterleaved(head);
+        else clone = s.cloneLinkedListParallel(head,threads);
+        auto end = chrono::high_resolution_clock::now();
+        size_t extra = peakBytes - before;
+
+        double sec = chrono::duration<double>(end-start).count();
+        const char* names[] = {"hash map    ", "interleaved ", "parallel    "};
+        cout<<names[mode]<<": "<<n/sec/1e6<<" M nodes/s, peak extra heap "<<extra/(1024*1024)<<" MB";
+        cout<<(sameShape(head,clone) ? "" : "  WRONG")<<endl;
+
+        if(mode == 0){
+            // a node-by-node list, then a block, both compacted in place
+            clone = s.compact(s.compact(clone), true);
+            if(!sameShape(head,clone)) cout<<"compact WRONG"<<endl;
+        }
+        Solution::releaseBlock(clone);
+    }
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<cstdint>
+#include<cstdlib>
+#include<chrono>
+#include<random>
+using namespace std;
+
+// Doubly linked list whose links are 32-bit indices into one node array
+// instead of two 64-bit pointers: 12 bytes per int instead of 24 (plus the
+// malloc header every `new` node pays). Index 0 is the NULL link.
+// Positional operations start from whichever of head, tail or the cached
+// finger (last node touched and its position) is closest.
+// Positions are 1-based like DoublyLinkedList.cpp.
+
+class CompactNode{
+    public:
+        int data;
+        uint32_t prev;
+        uint32_t next;
+};
+
+class CompactDoublyLinkedList{
+    public:
+        vector<CompactNode> nodes;
+        uint32_t head;
+        uint32_t tail;
+        uint32_t freeList;
+        int size;
+        uint32_t finger;
+        int fingerPos;
+
+    CompactDoublyLinkedList(){
+        nodes.resize(1);
+        head = tail = freeList = 0;
+        size = 0;
+        finger = 0;
+        fingerPos = 0;
+    }
+
+    int len(){
+        return size;
+    }
+
+    void insertAtHead(int d){
+        insertAtMiddle(1,d);
+    }
+
+    void insertAtTail(int d){
+        insertAtMiddle(size+1,d);
+    }
+
+    // n in [1, size+1]
+    void insertAtMiddle(int n,int d){
+        if(n < 1 || n > size+1) return;
+
+        uint32_t node = allocate(d);
+        uint32_t after = (n == size+1) ? 0 : locate(n);
+        uint32_t before = after ? nodes[after].prev : tail;
+
+        nodes[node].prev = before;
+        nodes[node].next = after;
+        if(before) nodes[before].next = node;
+        else head = node;
+        if(after) nodes[after].prev = node;
+        else tail = node;
+
+        size++;
+        finger = node;
+        fingerPos = n;
+    }
+
+    // pos in [1, size]
+    void deleteNode(int pos){
+        if(pos < 1 || pos > size) return;
+
+        uint32_t node = locate(pos);
+        uint32_t before = nodes[node].prev;
+        uint32_t after = nodes[node].next;
+
+        if(before) nodes[before].next = after;
+        else head = after;
+        if(after) nodes[after].prev = before;
+        else tail = before;
+
+        nodes[node].next = freeList;
+        freeList = node;
+        size--;
+
+        // keep the finger on the node that slid into this position
+        if(after){
+            finger = after;
+            fingerPos = pos;
+        }
+        else{
+            finger = before;
+            fingerPos = pos-1;
+        }
+    }
+
+    // pos in [1, size]; returns false and leaves value alone outside it
+    bool get(int pos,int &value){
+        if(pos < 1 || pos > size) return false;
+
+        value = nodes[locate(pos)].data;
+        return true;
+    }
+
+    void print(){
+        for(uint32_t i = head; i; i = nodes[i].next){
+            cout<<nodes[i].data<<" ";
+        }
+        cout<<endl;
+    }
+
+    size_t bytesUsed(){
+        return nodes.capacity() * sizeof(CompactNode);
+    }
+
+    private:
+    uint32_t allocate(int d){
+        uint32_t node;
+        if(freeList){
+            node = freeList;
+            freeList = nodes[node].next;
+        }
+        else{
+            node = nodes.size();
+            nodes.push_back(CompactNode());
+        }
+        nodes[node].data = d;
+        return node;
+    }
+
+    // index of the node at pos, walking from the nearest known position
+    uint32_t locate(int pos){
+        uint32_t curr;
+        int at;
+
+        int fromHead = pos - 1;
+        int fromTail = size - pos;
+        int fromFinger = finger ? abs(pos - fingerPos) : size;
+
+        if(fromFinger <= fromHead && fromFinger <= fromTail){
+            curr = finger;
+            at = fingerPos;
+        }
+        else if(fromHead <= fromTail){
+            curr = head;
+            at = 1;
+        }
+        else{
+            curr = tail;
+            at = size;
+        }
+
+        while(at < pos){
+            curr = nodes[curr].next;
+            at++;
+        }
+        while(at > pos){
+            curr = nodes[curr].prev;
+            at--;
+        }
+
+        finger = curr;
+        fingerPos = pos;
+        return curr;
+    }
+};
+
+#include "ListBaselines.h"
+
+// positions drift around a moving cursor, with occasional tail appends:
+// the pattern an editor buffer or a log with a read cursor produces
+void benchmark(int n,int ops){
+    mt19937 rng(5);
+    DoublyLinkedList* head = NULL;
+    DoublyLinkedList* tail = NULL;
+    CompactDoublyLinkedList list;
+    for(int i=0;i<n;i++){
+        DoublyLinkedList* node = new DoublyLinkedList(i);
+        if(tail){
+            tail->next = node;
+            node->prev = tail;
+        }
+        else head = node;
+        tail = node;
+        list.insertAtTail(i);
+    }
+
+    vector<int> positions(ops);
+    int cursor = n/2;
+    for(int i=0;i<ops;i++){
+        if(i % 10 == 0) positions[i] = n;
+        else{
+            cursor += (int)(rng() % 41) - 20;
+            cursor = max(1,min(n,cursor));
+            positions[i] = cursor;
+        }
+    }
+
+    auto t0 = chrono::high_resolution_clock::now();
+    for(int i=0;i<ops;i++){
+        insertAt(positions[i],i,head,tail);
+        deleteAt(positions[i],head,tail);
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    for(int i=0;i<ops;i++){
+        list.insertAtMiddle(positions[i],i);
+        list.deleteNode(positions[i]);
+    }
+    auto t2 = chrono::high_resolution_clock::now();
+
+    cout<<"n = "<<n<<": pointer list "<<chrono::duration<double,micro>(t1-t0).count()/(2*ops)<<" us/op, "
+        <<2*sizeof(DoublyLinkedList*)<<" B links/node"
+        <<" | compact list "<<chrono::duration<double,micro>(t2-t1).count()/(2*ops)<<" us/op, "
+        <<2*sizeof(uint32_t)<<" B links/node"<<endl;
+    cout<<"  node size "<<sizeof(DoublyLinkedList)<<" B (+ malloc header) vs "<<sizeof(CompactNode)
+        <<" B, compact list total "<<list.bytesUsed()/1024<<" KB"<<endl;
+
+    deleteAll(head,tail);
+}
+
+int main(){
+
+    CompactDoublyLinkedList list;
+    list.insertAtHead(11);
+    list.insertAtHead(10);
+    list.insertAtTail(13);
+    list.insertAtMiddle(3,12);
+    list.print();
+    cout<<list.len()<<endl;
+
+    list.deleteNode(1);
+    list.print();
+    list.deleteNode(2);
+    list.print();
+    list.insertAtTail(14);
+    list.insertAtMiddle(2,12);
+    list.print();
+    int second = 0, last = 0;
+    if(list.get(2,second) && list.get(list.len(),last)){
+        cout<<"2nd: "<<second<<", last: "<<last<<endl;
+    }
+    cout<<"0th present: "<<list.get(0,last)<<", past the end present: "<<list.get(list.len()+1,last)<<endl;
+    cout<<"---------------"<<endl;
+
+    int sizes[] = {1000, 10000, 100000};
+    for(int n : sizes){
+        benchmark(n,20000);
+    }
+    return 0;
+}
@@ -6,6 +6,14 @@
  *     ListNode(int x) : val(x), next(NULL) {}
  * };
  */
+// result of detectCycle: start == NULL and length == 0 when acyclic;
+// steps counts pointer moves, to compare against Floyd
+struct CycleInfo {
+    ListNode* start;
+    int length;
+    long long steps;
+};
+
 class Solution {
 public:
     bool hasCycle(ListNode *head) {
@@ -35,4 +43,78 @@ public:
         }
         return false;
     }
+
+    // Brent: the hare walks alone and the tortoise teleports to it at every
+    // power of two, so each step moves one pointer instead of three and the
+    // cycle length falls out directly. A second walk with the hare `length`
+    // ahead meets at the first node of the cycle.
+    CycleInfo detectCycle(ListNode *head) {
+        CycleInfo info = {NULL, 0, 0};
+        if(head == NULL){
+            return info;
+        }
+        ListNode* tortoise = head;
+        ListNode* hare = head->next;
+        int power = 1;
+        int length = 1;
+        info.steps = 1;
+
+        while(hare != NULL && hare != tortoise){
+            if(power == length){
+                tortoise = hare;
+                power *= 2;
+                length = 0;
+            }
+            hare = hare->next;
+            length++;
+            info.steps++;
+        }
+        if(hare == NULL){
+            return info;
+        }
+
+        tortoise = hare = head;
+        for(int i=0;i<length;i++){
+            hare = hare->next;
+        }
+        info.steps += length;
+        while(tortoise != hare){
+            tortoise = tortoise->next;
+            hare = hare->next;
+            info.steps += 2;
+        }
+        info.start = tortoise;
+        info.length = length;
+        return info;
+    }
+
+    // checks many independent lists: workers claim the next BATCH lists
+    // from a shared counter until none are left, so one long list does not
+    // hold up the rest and short lists do not fight over the counter
+    static const size_t BATCH = 64;
+
+    vector<CycleInfo> detectCycles(const vector<ListNode*> &heads, int threads) {
+        vector<CycleInfo> result(heads.size());
+        atomic<size_t> nextList(0);
+
+        auto worker = [&](){
+            size_t first;
+            while((first = nextList.fetch_add(BATCH)) < heads.size()){
+                size_t last = min(first + BATCH, heads.size());
+                for(size_t i=first;i<last;i++){
+                    result[i] = detectCycle(heads[i]);
+                }
+            }
+        };
+
+        vector<thread> pool;
+        for(int t=1;t<threads;t++){
+            pool.push_back(thread(worker));
+        }
+        worker();
+        for(thread &t : pool){
+            t.join();
+        }
+        return result;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<atomic>
+#include<thread>
+#include<chrono>
+#include<random>
+#include<cstdlib>
+using namespace std;
+
+struct ListNode {
+    int val;
+    ListNode *next;
+    ListNode(int x) : val(x), next(NULL) {}
+};
+
+#include "CycleDetection.cpp"
+
+// Pointer steps per node and wall clock for Floyd (hasCycle), Brent
+// (detectCycle) and the batch API over many lists, some of them cyclic.
+
+// Floyd's loop from hasCycle, counting pointer moves, plus the usual
+// second phase to find the start so both report the same thing
+long long floydSteps(ListNode* head){
+    ListNode* slow = head;
+    ListNode* fast = head;
+    long long steps = 0;
+    while(fast && fast->next){
+        slow = slow->next;
+        fast = fast->next->next;
+        steps += 3;
+        if(slow == fast){
+            slow = head;
+            while(slow != fast){
+                slow = slow->next;
+                fast = fast->next;
+                steps += 2;
+            }
+            return steps;
+        }
+    }
+    return steps;
+}
+
+// nodes are linked in shuffled memory order; every other list has its tail
+// pointing back to a random node
+vector<ListNode*> buildLists(vector<ListNode> &pool,int lists,int len,mt19937 &rng){
+    vector<ListNode*> order(pool.size());
+    for(size_t i=0;i<pool.size();i++) order[i] = &pool[i];
+    shuffle(order.begin(),order.end(),rng);
+
+    vector<ListNode*> heads(lists);
+    for(int l=0;l<lists;l++){
+        ListNode** run = &order[(size_t)l*len];
+        for(int i=0;i+1<len;i++) run[i]->next = run[i+1];
+        run[len-1]->next = (l % 2) ? run[rng() % len] : NULL;
+        heads[l] = run[0];
+    }
+    return heads;
+}
+
+int main(int argc,char** argv){
+
+    int total = argc > 1 ? atoi(argv[1]) : 4000000;
+    int threads = max(1u,thread::hardware_concurrency());
+    int lengths[] = {16, 1000, 100000};
+
+    ListNode a(1), b(2), c(3), d(4);
+    a.next = &b; b.next = &c; c.next = &d; d.next = &b;
+    Solution s;
+    CycleInfo info = s.detectCycle(&a);
+    cout<<"1->2->3->4->2: start "<<info.start->val<<", length "<<info.length<<endl;
+    cout<<"---------------"<<endl;
+
+    cout<<threads<<" threads"<<endl;
+    for(int len : lengths){
+        int lists = max(1,total/len);
+        vector<ListNode> pool((size_t)lists*len, ListNode(0));
+        mt19937 rng(len);
+        vector<ListNode*> heads = buildLists(pool,lists,len,rng);
+        double nodes = (double)lists*len;
+
+        long long floyd = 0;
+        long long brent = 0;
+        int found = 0;
+        for(ListNode* h : heads){
+            floyd += floydSteps(h);
+            brent += s.detectCycle(h).steps;
+        }
+
+        auto t0 = chrono::high_resolution_clock::now();
+        for(ListNode* h : heads) found += s.hasCycle(h);
+        auto t1 = chrono::high_resolution_clock::now();
+        int brentFound = 0;
+        for(ListNode* h : heads) brentFound += s.detectCycle(h).start != NULL;
+        auto t2 = chrono::high_resolution_clock::now();
+        vector<CycleInfo> batch = s.detectCycles(heads,threads);
+        auto t3 = chrono::high_resolution_clock::now();
+
+        int batchFound = 0;
+        for(CycleInfo &r : batch) batchFound += r.start != NULL;
+        bool ok = found == lists/2 && brentFound == found && batchFound == found;
+
+        cout<<lists<<" lists of "<<len<<": steps/node Floyd "<<floyd/nodes<<", Brent "<<brent/nodes
+            <<" | ns/node hasCycle "<<chrono::duration<double,nano>(t1-t0).count()/nodes
+            <<", detectCycle "<<chrono::duration<double,nano>(t2-t1).count()/nodes
+            <<", batch "<<chrono::duration<double,nano>(t3-t2).count()/nodes
+            <<(ok ? "" : "  WRONG")<<endl;
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include<iostream>
+#include<vector>
+#include<unordered_set>
+#include<queue>
+#include<algorithm>
+#include<chrono>
+#include<random>
+#include<cstdio>
+#include<cstdint>
+#include<climits>
+#include<cstdlib>
+#include<new>
+using namespace std;
+
+// Throughput and peak extra heap of the unordered_set dedup against the
+// budgeted one in each of its modes. Peak heap covers operator new only
+// (not stdio's file buffers).
+
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+
+// every block carries its size in front so delete can subtract it; kept
+// out of line so GCC does not follow the offset into the caller's object
+// and warn about it
+[[gnu::noinline]] void* operator new(size_t size){
+    size_t* p = (size_t*)malloc(size + sizeof(size_t) * 2);
+    if(p == NULL) throw bad_alloc();
+    p[0] = size;
+    liveBytes += size;
+    peakBytes = max(peakBytes,liveBytes);
+    return p + 2;
+}
+
+[[gnu::noinline]] void operator delete(void* ptr) noexcept{
+    if(ptr == NULL) return;
+    size_t* p = (size_t*)ptr - 2;
+    liveBytes -= p[0];
+    free(p);
+}
+
+void operator delete(void* ptr,size_t) noexcept{
+    operator delete(ptr);
+}
+
+struct Node {
+  int data;
+  struct Node *next;
+  Node(int x) {
+    data = x;
+    next = NULL;
+  }
+
+  // nodes bypass the counter, so the peak is the dedup structures alone
+  static void* operator new(size_t size){ return malloc(size); }
+  static void operator delete(void* ptr){ free(ptr); }
+};
+
+#include "DeleteDupFromUnsortedLL.cpp"
+
+Node* build(const vector<int> &values){
+    Node* head = NULL;
+    for(int i=(int)values.size()-1;i>=0;i--){
+        Node* node = new Node(values[i]);
+        node->next = head;
+        head = node;
+    }
+    return head;
+}
+
+// first occurrences in order, as the result must be
+vector<int> expected(const vector<int> &values){
+    unordered_set<int> seen;
+    vector<int> keep;
+    for(int v : values){
+        if(seen.insert(v).second) keep.push_back(v);
+    }
+    return keep;
+}
+
+bool matches(Node* head,const vector<int> &keep){
+    size_t i = 0;
+    for(; head; head = head->next, i++){
+        if(i == keep.size() || head->data != keep[i]) return false;
+    }
+    return i == keep.size();
+}
+
+void deleteList(Node* head){
+    while(head){
+        Node* next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+int main(int argc,char** argv){
+
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    mt19937 rng(9);
+
+    // a zero budget spills into the most partitions instead of dividing by 0
+    {
+        vector<int> values = {3, 1, 3, 2, 1, 7, 2};
+        Solution s;
+        Node* head = s.removeDuplicates(build(values), 0);
+        cout<<"budget 0: "<<(matches(head, expected(values)) ? "ok" : "WRONG")
+            <<", "<<s.lastStats.partitions<<" partitions"<<endl;
+        deleteList(head);
+    }
+
+    struct Case { const char* name; int range; size_t budget; };
+    Case cases[] = {
+        {"keys < 1M,   budget 16 MB", 1000000, 16u << 20},
+        {"any int,     budget 250 MB", INT_MAX, 250u << 20},
+        {"any int,     budget 16 MB", INT_MAX, 16u << 20},
+    };
+    const char* modes[] = {"bitmap", "hash", "spill"};
+
+    for(Case &c : cases){
+        vector<int> values(n);
+        for(int &v : values) v = (int)(rng() % c.range) - (c.range == INT_MAX ? INT_MAX/2 : 0);
+        // about a third of the list repeats earlier values
+        for(int i=1;i<n;i++){
+            if(rng() % 3 == 0) values[i] = values[rng() % i];
+        }
+        vector<int> keep = n <= 5000000 ? expected(values) : vector<int>();
+
+        cout<<n<<" nodes, "<<c.name<<endl;
+        for(int mode=0;mode<2;mode++){
+            Node* head = build(values);
+            Solution s;
+            size_t before = liveBytes;
+            peakBytes = liveBytes;
+            auto start = chrono::high_resolution_clock::now();
+            if(mode == 0) head = s.removeDuplicates(head);
+            else head = s.removeDuplicates(head,c.budget);
+            auto end = chrono::high_resolution_clock::now();
+            size_t extra = peakBytes - before;
+
+            double sec = chrono::duration<double>(end-start).count();
+            cout<<"  "<<(mode == 0 ? "unordered_set" : "budgeted     ")<<": "<<n/sec/1e6<<" M nodes/s, peak extra heap "
+                <<extra/1024<<" KB";
+            if(mode == 1){
+                cout<<" ("<<modes[s.lastStats.mode];
+                if(s.lastStats.mode == Solution::SPILL){
+                    cout<<", "<<s.lastStats.partitions<<" partitions, "<<s.lastStats.spilledBytes/(1024*1024)<<" MB spilled";
+                }
+                cout<<")";
+            }
+            if(!keep.empty()) cout<<(matches(head,keep) ? "" : "  WRONG");
+            cout<<endl;
+            deleteList(head);
+        }
+    }
+    return 0;
+}
@@ -59,4 +59,237 @@ class Solution {
         }
         return head;
     }
+
+    // Same result (first occurrence kept, later ones deleted) within a
+    // memory budget in bytes, picking the cheapest exact method that fits:
+    //   BITMAP: one bit per value in [min, max], when the range is small
+    //   HASH:   open-addressing set of the values seen, when even an
+    //           all-distinct list fits
+    //   SPILL:  (position, value) records are hash-partitioned into
+    //           temporary files sized so one partition's set fits; each
+    //           partition yields the sorted positions of its duplicates,
+    //           which a final pass merges to unlink them
+    // lastStats describes the latest call.
+    enum DedupMode { BITMAP, HASH, SPILL };
+
+    struct DedupStats {
+        DedupMode mode;
+        long long removed;
+        size_t peakBytes;       // largest bitmap or set held at once
+        size_t spilledBytes;    // written to temporary files
+        int partitions;
+    };
+
+    DedupStats lastStats;
+
+    // every partition holds two open files; past this the budget is
+    // exceeded rather than running out of descriptors
+    static constexpr int MAX_PARTITIONS = 256;
+
+    static uint64_t mix(uint64_t x){
+        x *= 0x9E3779B97F4A7C15ULL;
+        return x ^ (x >> 29);
+    }
+
+    // grows at half load, so it costs about 16 bytes per distinct value
+    class OpenSet {
+      public:
+        static constexpr int64_t EMPTY = INT64_MIN;
+        vector<int64_t> slots;
+        size_t used;
+        size_t peakBytes;
+
+        OpenSet(){
+            slots.assign(16, EMPTY);
+            used = 0;
+            peakBytes = slots.size() * sizeof(int64_t);
+        }
+
+        // false if x was already there
+        bool insert(int x){
+            if(2*(used+1) > slots.size()) grow();
+            size_t mask = slots.size()-1;
+            for(size_t i = mix((uint32_t)x) & mask;; i = (i+1) & mask){
+                if(slots[i] == EMPTY){
+                    slots[i] = x;
+                    used++;
+                    return true;
+                }
+                if(slots[i] == x) return false;
+            }
+        }
+
+        void grow(){
+            vector<int64_t> old(slots.size()*2, EMPTY);
+            old.swap(slots);
+            peakBytes = max(peakBytes, (old.size() + slots.size()) * sizeof(int64_t));
+            used = 0;
+            for(int64_t v : old){
+                if(v != EMPTY) insert((int)v);
+            }
+        }
+    };
+
+    // unlinks and deletes every node for which seen(data) says it is not
+    // the first occurrence; the head never is
+    template<typename Seen>
+    long long unlinkSeen(Node* head, Seen seen){
+        long long removed = 0;
+        Node* prev = head;
+        seen(head->data);
+        while(prev->next){
+            Node* curr = prev->next;
+            if(seen(curr->data)){
+                prev->next = curr->next;
+                delete curr;
+                removed++;
+            }
+            else{
+                prev = curr;
+            }
+        }
+        return removed;
+    }
+
+    // a budget of 0 is treated as 1 byte
+    Node *removeDuplicates(Node *head, size_t memoryBudget) {
+        memoryBudget = max(memoryBudget, (size_t)1);
+        lastStats = {BITMAP, 0, 0, 0, 0};
+        if(head == NULL){
+            return head;
+        }
+
+        long long lo = head->data, hi = head->data;
+        size_t count = 0;
+        for(Node* curr = head; curr; curr = curr->next){
+            lo = min(lo, (long long)curr->data);
+            hi = max(hi, (long long)curr->data);
+            count++;
+        }
+
+        size_t bitmapBytes = (hi - lo) / 64 * 8 + 8;
+        // a set for `count` distinct values, including the copy while it grows
+        size_t setBytes = 48 * count;
+
+        if(bitmapBytes <= memoryBudget){
+            vector<uint64_t> bits(bitmapBytes / 8, 0);
+            lastStats.peakBytes = bitmapBytes;
+            lastStats.removed = unlinkSeen(head, [&](int x){
+                uint64_t off = x - lo;
+                uint64_t bit = 1ULL << (off % 64);
+                bool seen = bits[off / 64] & bit;
+                bits[off / 64] |= bit;
+                return seen;
+            });
+        }
+        else if(setBytes <= memoryBudget){
+            OpenSet set;
+            lastStats.mode = HASH;
+            lastStats.removed = unlinkSeen(head, [&](int x){ return !set.insert(x); });
+            lastStats.peakBytes = set.peakBytes;
+        }
+        else{
+            int partitions = min<size_t>(MAX_PARTITIONS, (setBytes + memoryBudget - 1) / memoryBudget);
+            if(!removeBySpilling(head, partitions)){
+                // temporary files failed: exact, but over budget
+                long long removed = lastStats.removed;
+                OpenSet set;
+                lastStats = {HASH, 0, 0, 0, 0};
+                lastStats.removed = removed + unlinkSeen(head, [&](int x){ return !set.insert(x); });
+                lastStats.peakBytes = set.peakBytes;
+            }
+        }
+        return head;
+    }
+
+    struct Record {
+        uint64_t pos;
+        int data;
+    };
+
+    // false if temporary files cannot be created, written or read back.
+    // Up to the merge nothing in the list has changed; a failure during the
+    // merge leaves only duplicates removed, so the caller can finish the job
+    // in memory either way.
+    bool removeBySpilling(Node* head, int partitions){
+        lastStats.mode = SPILL;
+        lastStats.partitions = partitions;
+
+        // one run of records and one of duplicate positions per partition
+        vector<FILE*> runs(partitions, NULL), dups(partitions, NULL);
+        auto fail = [&](){
+            for(int p=0;p<partitions;p++){
+                if(runs[p]) fclose(runs[p]);
+                if(dups[p]) fclose(dups[p]);
+            }
+            return false;
+        };
+        for(int p=0;p<partitions;p++){
+            runs[p] = tmpfile();
+            dups[p] = tmpfile();
+            if(runs[p] == NULL || dups[p] == NULL) return fail();
+        }
+
+        // the partition hash must not line up with OpenSet's slot hash
+        auto partitionOf = [&](int x){ return (int)((mix((uint32_t)x ^ 0x5bd1e995) >> 32) % partitions); };
+
+        uint64_t pos = 0;
+        for(Node* curr = head; curr; curr = curr->next){
+            Record r = {pos++, curr->data};
+            if(fwrite(&r, sizeof(Record), 1, runs[partitionOf(r.data)]) != 1) return fail();
+        }
+        lastStats.spilledBytes = pos * sizeof(Record);
+
+        // each partition's duplicates come out in increasing position order
+        vector<Record> buffer(4096);
+        for(int p=0;p<partitions;p++){
+            // buffered write errors only show up on flush; rewind would clear them
+            if(fflush(runs[p]) != 0) return fail();
+            rewind(runs[p]);
+            OpenSet set;
+            size_t got;
+            while((got = fread(buffer.data(), sizeof(Record), buffer.size(), runs[p])) > 0){
+                for(size_t i=0;i<got;i++){
+                    if(!set.insert(buffer[i].data)){
+                        if(fwrite(&buffer[i].pos, sizeof(uint64_t), 1, dups[p]) != 1) return fail();
+                        lastStats.spilledBytes += sizeof(uint64_t);
+                    }
+                }
+            }
+            if(ferror(runs[p])) return fail();
+            lastStats.peakBytes = max(lastStats.peakBytes, set.peakBytes);
+            fclose(runs[p]);
+            runs[p] = NULL;
+            if(fflush(dups[p]) != 0) return fail();
+            rewind(dups[p]);
+        }
+
+        priority_queue<pair<uint64_t,int>, vector<pair<uint64_t,int>>, greater<pair<uint64_t,int>>> next;
+        uint64_t at;
+        for(int p=0;p<partitions;p++){
+            if(fread(&at, sizeof(uint64_t), 1, dups[p]) == 1) next.push({at, p});
+            else if(ferror(dups[p])) return fail();
+        }
+
+        Node* prev = head;
+        pos = 1;
+        while(!next.empty()){
+            uint64_t target = next.top().first;
+            int p = next.top().second;
+            next.pop();
+            while(pos < target){
+                prev = prev->next;
+                pos++;
+            }
+            Node* curr = prev->next;
+            prev->next = curr->next;
+            delete curr;
+            pos++;
+            lastStats.removed++;
+            if(fread(&at, sizeof(uint64_t), 1, dups[p]) == 1) next.push({at, p});
+            else if(ferror(dups[p])) return fail();
+        }
+        for(FILE* f : dups) fclose(f);
+        return true;
+    }
 };
\ No newline at end of file
@@ -1,4 +1,9 @@
 #include<iostream>
+#include<vector>
+#include<algorithm>
+#include<chrono>
+#include<new>
+#include<random>
 using namespace std;
 
 class DoublyLinkedList{
@@ -14,8 +19,14 @@ class DoublyLinkedList{
     }
 };
 
+#include "NodePool.h"
+
+// one pool for every list in this file; like the list functions it is not
+// thread-safe, so only one thread may touch these lists at a time
+NodePool<DoublyLinkedList> nodePool;
+
 void insertAtHead(DoublyLinkedList* &head,DoublyLinkedList* &tail,int d){
-    DoublyLinkedList* newNode = new DoublyLinkedList(d);
+    DoublyLinkedList* newNode = nodePool.allocate(d);
     if(head == NULL){
         head = newNode;
         tail = newNode;
@@ -27,7 +38,7 @@ void insertAtHead(DoublyLinkedList* &head,DoublyLinkedList* &tail,int d){
 }
 
 void insertAtTail(DoublyLinkedList* &tail, DoublyLinkedList* &head,int d){
-    DoublyLinkedList* newNode = new DoublyLinkedList(d);
+    DoublyLinkedList* newNode = nodePool.allocate(d);
     if(tail == NULL){
         head = newNode;
         tail = newNode;
@@ -54,7 +65,7 @@ void insertAtMiddle(int n,int d,DoublyLinkedList* &head,DoublyLinkedList* &tail)
         insertAtTail(tail,head,d);
         return;
     }
-    DoublyLinkedList* newNode = new DoublyLinkedList(d);
+    DoublyLinkedList* newNode = nodePool.allocate(d);
     newNode->next = temp->next;
     temp->next->prev = newNode;
     temp->next = newNode;
@@ -71,7 +82,7 @@ void deleteNode(int pos,DoublyLinkedList* &head,DoublyLinkedList* &tail){
         else
             tail = NULL;
 
-        delete temp;
+        nodePool.release(temp);
         return;
     }
     DoublyLinkedList* curr = head;
@@ -85,12 +96,12 @@ void deleteNode(int pos,DoublyLinkedList* &head,DoublyLinkedList* &tail){
     if(curr->next == NULL){
         tail = curr->prev;
         tail->next = NULL;
-        delete curr;
+        nodePool.release(curr);
         return;
     }
     curr->prev->next = curr->next;
     curr->next->prev = curr->prev;
-    delete curr;
+    nodePool.release(curr);
 }
 
 int len(DoublyLinkedList* &head){
@@ -103,6 +114,30 @@ int len(DoublyLinkedList* &head){
     return cnt;
 }
 
+// Copies the list into one contiguous run in list order, fixing next and
+// prev, and recycles the old nodes; slabs left empty go back to the system.
+// Outside pointers to nodes are invalidated.
+void compact(DoublyLinkedList* &head,DoublyLinkedList* &tail){
+    int n = len(head);
+    if(n == 0) return;
+
+    DoublyLinkedList* run = nodePool.allocateRun(n);
+    DoublyLinkedList* temp = head;
+    for(int i=0;i<n;i++){
+        new(run+i) DoublyLinkedList(temp->data);
+        if(i > 0){
+            run[i-1].next = run+i;
+            run[i].prev = run+i-1;
+        }
+        temp = temp->next;
+    }
+
+    nodePool.releaseList(head,tail);
+    nodePool.trim();
+    head = run;
+    tail = run + n - 1;
+}
+
 void print(DoublyLinkedList* &head){
     DoublyLinkedList* temp = head;
     while(temp){
@@ -112,9 +147,63 @@ void print(DoublyLinkedList* &head){
     cout<<endl;
 }
 
+// nodes linked in random memory order, as after long churn; walks both ways
+void compactBenchmark(){
+    const int n = 2000000;
+    const int rounds = 10;
+
+    vector<DoublyLinkedList*> nodes(n);
+    for(int i=0;i<n;i++){
+        nodes[i] = nodePool.allocate(i);
+    }
+    shuffle(nodes.begin(),nodes.end(),mt19937(1));
+    for(int i=0;i+1<n;i++){
+        nodes[i]->next = nodes[i+1];
+        nodes[i+1]->prev = nodes[i];
+    }
+    DoublyLinkedList* head = nodes[0];
+    DoublyLinkedList* tail = nodes[n-1];
+    nodes.clear();
+
+    long long sum = 0;
+    auto t0 = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        for(DoublyLinkedList* temp = head; temp; temp = temp->next) sum += temp->data;
+        for(DoublyLinkedList* temp = tail; temp; temp = temp->prev) sum += temp->data;
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    compact(head,tail);
+    auto t2 = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        for(DoublyLinkedList* temp = head; temp; temp = temp->next) sum -= temp->data;
+        for(DoublyLinkedList* temp = tail; temp; temp = temp->prev) sum -= temp->data;
+    }
+    auto t3 = chrono::high_resolution_clock::now();
+
+    cout<<"Forward+backward traversal of "<<n<<" scattered nodes"<<(sum ? " (MISMATCH)" : "")<<endl;
+    cout<<"before compact: "<<chrono::duration<double,milli>(t1-t0).count()/rounds<<" ms/pass"<<endl;
+    cout<<"compact       : "<<chrono::duration<double,milli>(t2-t1).count()<<" ms"<<endl;
+    cout<<"after compact : "<<chrono::duration<double,milli>(t3-t2).count()/rounds<<" ms/pass"<<endl;
+
+    // a little churn between compactions, then compact again: the pool
+    // should keep about one run's worth of memory, not one per compaction
+    size_t afterFirst = nodePool.bytes;
+    for(int r=0;r<5;r++){
+        for(int i=0;i<1000;i++){
+            insertAtHead(head,tail,i);
+            deleteNode(2,head,tail);
+        }
+        compact(head,tail);
+    }
+    size_t slack = 2 * NodePool<DoublyLinkedList>::SLAB_SIZE * sizeof(DoublyLinkedList);
+    cout<<"pool after 1st compact "<<afterFirst/1024<<" KB, after 5 more "<<nodePool.bytes/1024<<" KB"
+        <<(nodePool.bytes > afterFirst + slack ? "  GROWING" : "")<<endl;
+    nodePool.releaseList(head,tail);
+}
+
 int main(){
 
-    DoublyLinkedList* node = new DoublyLinkedList(11);
+    DoublyLinkedList* node = nodePool.allocate(11);
 
     DoublyLinkedList* head = node;
     DoublyLinkedList* tail = node;
@@ -134,5 +223,13 @@ int main(){
     print(head);
     deleteNode(2,head,tail);
     print(head);
+    insertAtTail(tail,head,14);
+    insertAtHead(head,tail,9);
+    compact(head,tail);
+    print(head);
+    cout<<tail->prev->data<<endl;
+
+    cout<<"---------------"<<endl;
+    compactBenchmark();
     return 0;
 }
\ No newline at end of file
@@ -34,15 +34,63 @@ class Solution {
         result->next = NULL;
         return result;
     }
-    Node *flatten(Node *root) {
-        // code here
+    // recursion depth is the total node count: overflows the stack on
+    // large inputs, kept as the baseline
+    Node *flattenRecursive(Node *root) {
         if(root == NULL || root->next == NULL)
             return root;
             
-        root->next = flatten(root->next);
+        root->next = flattenRecursive(root->next);
         
         root = merge(root, root->next);
         
         return root;
     }
+
+    // moves heap[i] down until both children are not smaller
+    void siftDown(vector<Node*> &heap, int i){
+        int n = heap.size();
+        Node* node = heap[i];
+        while(2*i+1 < n){
+            int child = 2*i+1;
+            if(child+1 < n && heap[child+1]->data < heap[child]->data) child++;
+            if(node->data <= heap[child]->data) break;
+            heap[i] = heap[child];
+            i = child;
+        }
+        heap[i] = node;
+    }
+
+    // k-way merge of the bottom chains through a min-heap of their heads:
+    // O(N log k) time, O(k) extra memory, no recursion. The smallest head
+    // is replaced by its successor in place, one sift per output node.
+    Node *flatten(Node *root) {
+        vector<Node*> heap;
+        for(Node* col = root; col; col = col->next){
+            heap.push_back(col);
+        }
+        for(int i=(int)heap.size()/2-1;i>=0;i--){
+            siftDown(heap, i);
+        }
+
+        Node dummy(0);
+        Node* tail = &dummy;
+        while(!heap.empty()){
+            Node* smallest = heap[0];
+            tail->bottom = smallest;
+            tail = smallest;
+            smallest->next = NULL;
+
+            if(smallest->bottom){
+                heap[0] = smallest->bottom;
+            }
+            else{
+                heap[0] = heap.back();
+                heap.pop_back();
+            }
+            if(!heap.empty()) siftDown(heap, 0);
+        }
+        tail->bottom = NULL;
+        return dummy.bottom;
+    }
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<chrono>
+#include<random>
+#include<cstdlib>
+using namespace std;
+
+class Node {
+public:
+    int data;
+    Node* next;
+    Node* bottom;
+
+    Node(int x) {
+        data = x;
+        next = NULL;
+        bottom = NULL;
+    }
+};
+
+#include "FlattenLL.cpp"
+
+// Heap flatten against the recursive one on multi-level lists of growing
+// size. The recursive version only runs while its depth (the node count)
+// stays well inside the default stack, and its O(N*k) merging keeps it off
+// the widest inputs.
+
+const int RECURSIVE_LIMIT = 100000;
+const int RECURSIVE_COLUMNS = 256;
+
+// k sorted bottom chains of n/k nodes each, nodes in shuffled memory order
+Node* build(vector<Node> &pool,int k,mt19937 &rng){
+    int n = pool.size();
+    vector<Node*> order(n);
+    for(int i=0;i<n;i++) order[i] = &pool[i];
+    shuffle(order.begin(),order.end(),rng);
+
+    Node* root = NULL;
+    for(int c=k-1;c>=0;c--){
+        Node** col = &order[(size_t)c*(n/k)];
+        int len = (c == k-1) ? n - c*(n/k) : n/k;
+        vector<int> values(len);
+        for(int &v : values) v = rng() % 1000000000;
+        sort(values.begin(),values.end());
+        for(int i=0;i<len;i++){
+            col[i]->data = values[i];
+            col[i]->next = NULL;
+            col[i]->bottom = i+1 < len ? col[i+1] : NULL;
+        }
+        col[0]->next = root;
+        root = col[0];
+    }
+    return root;
+}
+
+// the recursive merge may leave a stale next on the last node, so only the
+// bottom chain is checked
+bool check(Node* head,int n){
+    int count = 0;
+    for(Node* x = head; x; x = x->bottom){
+        if(x->bottom && x->bottom->data < x->data) return false;
+        count++;
+    }
+    return count == n;
+}
+
+int main(int argc,char** argv){
+
+    int total = argc > 1 ? atoi(argv[1]) : 4000000;
+    int sizes[] = {10000, 100000, 1000000, total};
+    int columns[] = {8, 256, 8192};
+
+    for(int n : sizes){
+        for(int k : columns){
+            if(k > n) continue;
+            vector<Node> pool(n,Node(0));
+            mt19937 rng(n+k);
+            Solution s;
+
+            Node* root = build(pool,k,rng);
+            auto t0 = chrono::high_resolution_clock::now();
+            Node* flat = s.flatten(root);
+            auto t1 = chrono::high_resolution_clock::now();
+            bool ok = check(flat,n);
+            cout<<n<<" nodes, "<<k<<" columns: heap "<<chrono::duration<double,nano>(t1-t0).count()/n<<" ns/node";
+
+            if(n <= RECURSIVE_LIMIT && k <= RECURSIVE_COLUMNS){
+                mt19937 again(n+k);
+                root = build(pool,k,again);
+                t0 = chrono::high_resolution_clock::now();
+                flat = s.flattenRecursive(root);
+                t1 = chrono::high_resolution_clock::now();
+                ok = ok && check(flat,n);
+                cout<<", recursive "<<chrono::duration<double,nano>(t1-t0).count()/n<<" ns/node";
+            }
+            else{
+                cout<<", recursive skipped";
+            }
+            cout<<(ok ? "" : "  WRONG")<<endl;
+        }
+    }
+    return 0;
+}
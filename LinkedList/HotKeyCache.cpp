@@ -0,0 +1,217 @@
+#include<iostream>
+#include<vector>
+#include<unordered_map>
+#include<algorithm>
+#include<cmath>
+#include<chrono>
+#include<random>
+#include<stdexcept>
+using namespace std;
+
+// Fixed-capacity key/value cache on the circular doubly linked list from
+// DoublyCircularLinkedList.cpp. Nodes are found through a hash index and
+// spliced in and out by pointer, so get/put/evict never scan the list.
+//   LRU: one ring behind a sentinel, most recent right after it, the
+//        victim is sentinel->prev.
+//   LFU: one ring per access count; the victim is the least recently used
+//        node of the lowest count.
+// Nodes come from a block allocated up front and are recycled on eviction,
+// and destroying them prints nothing.
+
+class CacheNode{
+    public:
+        int key;
+        int value;
+        int freq;
+        CacheNode* next;
+        CacheNode* prev;
+
+    CacheNode(){
+        key = value = freq = 0;
+        next = prev = this;
+    }
+};
+
+enum Policy { LRU, LFU };
+
+class HotKeyCache{
+    public:
+        Policy policy;
+        int capacity;
+        vector<CacheNode> nodes;
+        int used;
+        unordered_map<int,CacheNode*> index;
+        unordered_map<int,CacheNode> rings;     // access count -> sentinel
+        int minFreq;
+        long long hits;
+        long long misses;
+
+    // evict() needs at least one real entry to remove, never a sentinel
+    HotKeyCache(int capacity,Policy policy){
+        if(capacity < 1){
+            throw invalid_argument("HotKeyCache capacity must be at least 1");
+        }
+        this->capacity = capacity;
+        this->policy = policy;
+        nodes.resize(capacity);
+        used = 0;
+        index.reserve(capacity*2);
+        minFreq = 0;
+        hits = misses = 0;
+    }
+
+    // returns false on a miss
+    bool get(int key,int &value){
+        auto it = index.find(key);
+        if(it == index.end()){
+            misses++;
+            return false;
+        }
+        hits++;
+        CacheNode* node = it->second;
+        touch(node);
+        value = node->value;
+        return true;
+    }
+
+    void put(int key,int value){
+        auto it = index.find(key);
+        if(it != index.end()){
+            it->second->value = value;
+            touch(it->second);
+            return;
+        }
+
+        CacheNode* node;
+        if(used < capacity){
+            node = &nodes[used++];
+        }
+        else{
+            node = evict();
+        }
+        node->key = key;
+        node->value = value;
+        node->freq = 1;
+        index[key] = node;
+        insertAfter(ring(1),node);
+        if(policy == LFU || minFreq == 0) minFreq = 1;
+    }
+
+    double hitRate(){
+        return hits + misses ? (double)hits / (hits + misses) : 0;
+    }
+
+    private:
+    static void unlink(CacheNode* node){
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    static void insertAfter(CacheNode* pos,CacheNode* node){
+        node->next = pos->next;
+        node->prev = pos;
+        pos->next->prev = node;
+        pos->next = node;
+    }
+
+    // LRU keeps everything on ring 1
+    CacheNode* ring(int freq){
+        return &rings[policy == LRU ? 1 : freq];
+    }
+
+    void touch(CacheNode* node){
+        unlink(node);
+        if(policy == LFU){
+            CacheNode* old = ring(node->freq);
+            if(old->next == old){
+                rings.erase(node->freq);
+                if(minFreq == node->freq) minFreq++;
+            }
+            node->freq++;
+        }
+        insertAfter(ring(node->freq),node);
+    }
+
+    CacheNode* evict(){
+        CacheNode* sentinel = ring(minFreq);
+        CacheNode* victim = sentinel->prev;
+        unlink(victim);
+        if(policy == LFU && sentinel->next == sentinel){
+            rings.erase(minFreq);
+        }
+        index.erase(victim->key);
+        return victim;
+    }
+};
+
+// draws ranks 0..n-1 with P(k) proportional to 1/(k+1)^s
+class Zipf{
+    public:
+        vector<double> cdf;
+        mt19937 rng;
+        uniform_real_distribution<double> unit;
+
+    Zipf(int n,double s,int seed){
+        cdf.resize(n);
+        double sum = 0;
+        for(int k=0;k<n;k++){
+            sum += 1.0 / pow(k+1,s);
+            cdf[k] = sum;
+        }
+        for(double &c : cdf) c /= sum;
+        rng.seed(seed);
+        unit = uniform_real_distribution<double>(0.0,1.0);
+    }
+
+    int next(){
+        return lower_bound(cdf.begin(),cdf.end(),unit(rng)) - cdf.begin();
+    }
+};
+
+int main(){
+
+    HotKeyCache lru(2,LRU);
+    int value;
+    lru.put(1,10);
+    lru.put(2,20);
+    lru.get(1,value);
+    lru.put(3,30);                      // evicts 2
+    cout<<"LRU get 2: "<<lru.get(2,value)<<", get 1: "<<lru.get(1,value)<<" ("<<value<<")"<<endl;
+
+    HotKeyCache lfu(2,LFU);
+    lfu.put(1,10);
+    lfu.put(2,20);
+    lfu.get(1,value);
+    lfu.get(1,value);
+    lfu.get(2,value);
+    lfu.put(3,30);                      // evicts 2 (count 2 < 3)
+    cout<<"LFU get 2: "<<lfu.get(2,value)<<", get 1: "<<lfu.get(1,value)<<", get 3: "<<lfu.get(3,value)<<endl;
+    cout<<"---------------"<<endl;
+
+    const int keys = 1000000;
+    const int ops = 10000000;
+    double skews[] = {0.8, 0.99, 1.2};
+    int capacities[] = {10000, 100000};
+
+    for(double s : skews){
+        Zipf zipf(keys,s,1);
+        vector<int> trace(ops);
+        // spread hot ranks over the key space so hashing sees no pattern
+        for(int &k : trace) k = (int)((zipf.next() * 2654435761u) % keys);
+
+        for(int cap : capacities){
+            for(int p=0;p<2;p++){
+                HotKeyCache cache(cap,(Policy)p);
+                auto start = chrono::high_resolution_clock::now();
+                for(int key : trace){
+                    if(!cache.get(key,value)) cache.put(key,key);
+                }
+                auto end = chrono::high_resolution_clock::now();
+                double sec = chrono::duration<double>(end-start).count();
+                cout<<"zipf s="<<s<<", capacity "<<cap<<", "<<(p == LRU ? "LRU" : "LFU")
+                    <<": "<<ops/sec/1e6<<" Mops/s, hit rate "<<cache.hitRate()*100<<"%"<<endl;
+            }
+        }
+    }
+    return 0;
+}
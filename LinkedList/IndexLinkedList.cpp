@@ -0,0 +1,285 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<cstdint>
+#include<cstdlib>
+#include<chrono>
+#include<random>
+#include<pthread.h>
+using namespace std;
+
+// Singly linked list whose links are int32 indices into two contiguous
+// arrays, value[] and next[]; -1 is the NULL link. Nodes keep their index
+// for life, so reversals relink exactly like the pointer versions in
+// ReverseLinkedList.cpp, Reverseitoj.cpp and kReverse.cpp.
+// The reversals work in bulk: one dependent walk gathers the traversal
+// order into a scratch array, the segments to reverse are reversed in that
+// array (plain std::reverse over contiguous ints, which the compiler
+// vectorizes), and one independent pass writes the new next[] links. Only
+// the gather still waits on each load.
+// Positions are 1-based like reverseBetween.
+
+class IndexLinkedList{
+    public:
+        vector<int> value;
+        vector<int32_t> next;
+        int32_t head;
+        vector<int32_t> order;      // scratch for the reversals
+
+    IndexLinkedList(){
+        head = -1;
+    }
+
+    // nodes linked in the given order of indices 0..values.size()-1
+    IndexLinkedList(const vector<int> &values,const vector<int32_t> &linkOrder){
+        value = values;
+        next.assign(values.size(),-1);
+        head = linkOrder.empty() ? -1 : linkOrder[0];
+        for(size_t i=0;i+1<linkOrder.size();i++){
+            next[linkOrder[i]] = linkOrder[i+1];
+        }
+    }
+
+    vector<int> toVector(){
+        vector<int> out;
+        for(int32_t i = head; i != -1; i = next[i]){
+            out.push_back(value[i]);
+        }
+        return out;
+    }
+
+    void reverse(){
+        int n = gather(head,-1);
+        std::reverse(order.begin(),order.begin()+n);
+        relink(n,-1);
+        head = n ? order[0] : -1;
+    }
+
+    void reverseBetween(int left,int right){
+        if(head == -1 || left >= right) return;
+
+        int32_t before = -1;
+        int32_t first = head;
+        for(int i=1;i<left && first != -1;i++){
+            before = first;
+            first = next[first];
+        }
+        int n = gather(first,right-left+1);
+        if(n == 0) return;
+        int32_t after = next[order[n-1]];
+
+        std::reverse(order.begin(),order.begin()+n);
+        relink(n,after);
+        if(before == -1) head = order[0];
+        else next[before] = order[0];
+    }
+
+    // a short last group stays as it is
+    void reverseKGroup(int k){
+        if(k < 2) return;
+        int n = gather(head,-1);
+        for(int start=0; start+k<=n; start+=k){
+            std::reverse(order.begin()+start,order.begin()+start+k);
+        }
+        relink(n,-1);
+        head = n ? order[0] : -1;
+    }
+
+    private:
+    // the first `limit` indices from `from` (all of them if limit < 0)
+    int gather(int32_t from,int limit){
+        if(order.size() < value.size()) order.resize(value.size());
+        int n = 0;
+        for(int32_t i = from; i != -1 && n != limit; i = next[i]){
+            order[n++] = i;
+        }
+        return n;
+    }
+
+    // links order[0..n) in sequence, the last one to `tail`
+    void relink(int n,int32_t tail){
+        for(int i=0;i+1<n;i++){
+            next[order[i]] = order[i+1];
+        }
+        if(n) next[order[n-1]] = tail;
+    }
+};
+
+// the current pointer versions, from ReverseLinkedList.cpp, Reverseitoj.cpp
+// and kReverse.cpp
+struct ListNode {
+    int val;
+    ListNode *next;
+    ListNode() : val(0), next(nullptr) {}
+    ListNode(int x) : val(x), next(nullptr) {}
+    ListNode(int x, ListNode *next) : val(x), next(next) {}
+};
+
+ListNode* reverseList(ListNode* head){
+    ListNode* prev = NULL;
+    ListNode* curr = head;
+    while(curr){
+        ListNode* next = curr->next;
+        curr->next = prev;
+        prev = curr;
+        curr = next;
+    }
+    return prev;
+}
+
+ListNode* reverseBetween(ListNode* head,int left,int right){
+    ListNode dummy(0,head);
+    ListNode* prev = &dummy;
+    for(int i=1;i<left;i++){
+        prev = prev->next;
+    }
+    ListNode* curr = prev->next;
+    for(int i=0;i<right-left;i++){
+        ListNode* forward = curr->next;
+        curr->next = forward->next;
+        forward->next = prev->next;
+        prev->next = forward;
+    }
+    return dummy.next;
+}
+
+ListNode* reverseKGroup(ListNode* head,int k){
+    if(head == NULL){
+        return NULL;
+    }
+
+    int cnt = 0;
+    ListNode* temp = head;
+    while(temp!=NULL && cnt<k){
+        temp = temp->next;
+        cnt++;
+    }
+    if (cnt < k) return head;
+
+    ListNode* next = NULL;
+    ListNode* curr = head;
+    ListNode* prev = NULL;
+    cnt = 0;
+
+    while(curr!=NULL && cnt<k){
+        next = curr->next;
+        curr->next = prev;
+        prev = curr;
+        curr = next;
+        cnt++;
+    }
+    if(next!=NULL){
+        head->next = reverseKGroup(next,k);
+    }
+    return prev;
+}
+
+vector<int> toVector(ListNode* head){
+    vector<int> out;
+    for(; head; head = head->next) out.push_back(head->val);
+    return out;
+}
+
+// reverseKGroup recurses once per group, so a 10M-node list with small k
+// needs far more stack than the default 8 MB: run it on a thread with a
+// stack sized to match
+template<typename F>
+void runWithStack(size_t bytes,F f){
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr,bytes);
+    pthread_t thread;
+    pthread_create(&thread,&attr,[](void* arg) -> void* {
+        (*(F*)arg)();
+        return NULL;
+    },&f);
+    pthread_join(thread,NULL);
+    pthread_attr_destroy(&attr);
+}
+
+int main(int argc,char** argv){
+
+    vector<int32_t> linkOrder = {3, 0, 4, 1, 2, 5, 6};
+    vector<int> values = {10, 30, 40, 0, 20, 50, 60};
+    IndexLinkedList list(values,linkOrder);
+    for(int x : list.toVector()) cout<<x<<" ";
+    cout<<endl;
+    list.reverseBetween(2,5);
+    for(int x : list.toVector()) cout<<x<<" ";
+    cout<<endl;
+    list.reverseKGroup(3);
+    for(int x : list.toVector()) cout<<x<<" ";
+    cout<<endl;
+
+    // random lists against the pointer versions
+    mt19937 rng(4);
+    bool ok = true;
+    for(int t=0;t<300;t++){
+        int n = 1 + rng() % 60;
+        vector<int> v(n);
+        vector<int32_t> o(n);
+        for(int i=0;i<n;i++){
+            v[i] = rng() % 100;
+            o[i] = i;
+        }
+        shuffle(o.begin(),o.end(),rng);
+        IndexLinkedList a(v,o);
+        vector<ListNode> nodes(n);
+        for(int i=0;i<n;i++) nodes[i].val = v[o[i]];
+        for(int i=0;i+1<n;i++) nodes[i].next = &nodes[i+1];
+        ListNode* b = &nodes[0];
+
+        int k = 1 + rng() % 8;
+        int left = 1 + rng() % n;
+        int right = left + rng() % (n-left+1);
+        a.reverseKGroup(k);
+        b = reverseKGroup(b,k);
+        a.reverseBetween(left,right);
+        b = reverseBetween(b,left,right);
+        a.reverse();
+        b = reverseList(b);
+        ok = ok && a.toVector() == toVector(b);
+    }
+    cout<<"random checks: "<<(ok ? "ok" : "FAILED")<<endl;
+    cout<<"---------------"<<endl;
+
+    // nodes linked in shuffled memory order, the same order for both lists
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    vector<int32_t> shuffled(n);
+    vector<int> data(n);
+    for(int i=0;i<n;i++) shuffled[i] = i;
+    shuffle(shuffled.begin(),shuffled.end(),rng);
+    for(int i=0;i<n;i++) data[shuffled[i]] = i;
+    IndexLinkedList index(data,shuffled);
+    vector<ListNode> pool(n);
+    for(int i=0;i<n;i++) pool[shuffled[i]].val = i;
+    ListNode* head = &pool[shuffled[0]];
+    for(int i=0;i+1<n;i++) pool[shuffled[i]].next = &pool[shuffled[i+1]];
+    pool[shuffled[n-1]].next = NULL;
+
+    auto time = [](auto f){
+        auto start = chrono::high_resolution_clock::now();
+        f();
+        return chrono::duration<double,milli>(chrono::high_resolution_clock::now()-start).count();
+    };
+
+    cout<<n<<" nodes, ms: pointer list | index list"<<endl;
+    double p = time([&](){ head = reverseList(head); });
+    double q = time([&](){ index.reverse(); });
+    cout<<"reverse               "<<p<<" | "<<q<<endl;
+
+    p = time([&](){ head = reverseBetween(head,n/4,3*(n/4)); });
+    q = time([&](){ index.reverseBetween(n/4,3*(n/4)); });
+    cout<<"reverseBetween n/2    "<<p<<" | "<<q<<endl;
+
+    int ks[] = {2, 16, 1024};
+    for(int k : ks){
+        p = time([&](){
+            runWithStack((size_t)(n/k + 1) * 128 + (1 << 20),[&](){ head = reverseKGroup(head,k); });
+        });
+        q = time([&](){ index.reverseKGroup(k); });
+        cout<<"reverseKGroup k="<<k<<(k < 10 ? "     " : k < 1000 ? "    " : "  ")<<p<<" | "<<q<<endl;
+    }
+    cout<<(toVector(head) == index.toVector() ? "same result" : "WRONG")<<endl;
+    return 0;
+}
@@ -0,0 +1,249 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<cstdlib>
+#include<chrono>
+#include<random>
+using namespace std;
+
+// Indexable skip list: a positional (not sorted) list where every forward
+// link also stores its width, i.e. how many elements it jumps over.
+// Insert/delete at a position, access by index and size are O(log n)
+// expected, against O(n) walks in SinglyLinkedList.cpp / DoublyLinkedList.cpp.
+// Positions are 1-based like the rest of this folder.
+
+class SkipNode{
+    public:
+        int data;
+        int level;
+        SkipNode** next;
+        int* width;
+
+    SkipNode(int data,int level){
+        this->data = data;
+        this->level = level;
+        this->next = new SkipNode*[level];
+        this->width = new int[level];
+        for(int i=0;i<level;i++){
+            next[i] = NULL;
+            width[i] = 0;
+        }
+    }
+
+    ~SkipNode(){
+        delete[] next;
+        delete[] width;
+    }
+};
+
+class IndexableSkipList{
+    public:
+        static const int MAX_LEVEL = 32;
+        SkipNode* head;
+        int size;
+        int levels;
+        mt19937 rng;
+
+    IndexableSkipList(){
+        head = new SkipNode(0,MAX_LEVEL);
+        size = 0;
+        levels = 1;
+        rng.seed(12345);
+    }
+
+    ~IndexableSkipList(){
+        SkipNode* temp = head;
+        while(temp){
+            SkipNode* next = temp->next[0];
+            delete temp;
+            temp = next;
+        }
+    }
+
+    int len(){
+        return size;
+    }
+
+    // n in [1, size+1]
+    void insertAtMiddle(int d,int n){
+        if(n < 1 || n > size+1) return;
+
+        SkipNode* update[MAX_LEVEL] = {};
+        int pos[MAX_LEVEL];
+        findPredecessors(n-1,update,pos);
+
+        int lvl = randomLevel();
+        if(lvl > levels){
+            for(int i=levels;i<lvl;i++){
+                update[i] = head;
+                pos[i] = 0;
+                head->width[i] = size + 1;
+            }
+            levels = lvl;
+        }
+
+        SkipNode* node = new SkipNode(d,lvl);
+        for(int i=0;i<levels;i++){
+            if(i < lvl){
+                // the new node sits (n-1 - pos[i]) elements after update[i]
+                int before = (n-1) - pos[i];
+                node->next[i] = update[i]->next[i];
+                node->width[i] = update[i]->width[i] - before;
+                update[i]->next[i] = node;
+                update[i]->width[i] = before + 1;
+            }
+            else{
+                update[i]->width[i]++;
+            }
+        }
+        size++;
+    }
+
+    void insertAtHead(int d){
+        insertAtMiddle(d,1);
+    }
+
+    void insertAtTail(int d){
+        insertAtMiddle(d,size+1);
+    }
+
+    // n in [1, size]
+    void deleteNode(int n){
+        if(n < 1 || n > size) return;
+
+        SkipNode* update[MAX_LEVEL] = {};
+        int pos[MAX_LEVEL];
+        findPredecessors(n-1,update,pos);
+
+        SkipNode* target = update[0]->next[0];
+        for(int i=0;i<levels;i++){
+            if(i < target->level){
+                update[i]->next[i] = target->next[i];
+                update[i]->width[i] += target->width[i] - 1;
+            }
+            else{
+                update[i]->width[i]--;
+            }
+        }
+        delete target;
+        size--;
+
+        while(levels > 1 && head->next[levels-1] == NULL){
+            head->width[levels-1] = 0;
+            levels--;
+        }
+    }
+
+    // n in [1, size]; returns false and leaves value alone outside it
+    bool get(int n,int &value){
+        if(n < 1 || n > size) return false;
+
+        SkipNode* temp = head;
+        int traversed = 0;
+        for(int i=levels-1;i>=0;i--){
+            while(temp->next[i] && traversed + temp->width[i] <= n){
+                traversed += temp->width[i];
+                temp = temp->next[i];
+            }
+        }
+        value = temp->data;
+        return true;
+    }
+
+    void print(){
+        SkipNode* temp = head->next[0];
+        while(temp){
+            cout<<temp->data<<" ";
+            temp = temp->next[0];
+        }
+        cout<<endl;
+    }
+
+    private:
+    int randomLevel(){
+        int lvl = 1;
+        // each level kept with probability 1/2
+        unsigned bits = rng();
+        while((bits & 1) && lvl < MAX_LEVEL){
+            lvl++;
+            bits >>= 1;
+        }
+        return lvl;
+    }
+
+    // last node at each level whose position is <= index (head is position 0)
+    void findPredecessors(int index,SkipNode** update,int* pos){
+        SkipNode* temp = head;
+        int traversed = 0;
+        for(int i=levels-1;i>=0;i--){
+            while(temp->next[i] && traversed + temp->width[i] <= index){
+                traversed += temp->width[i];
+                temp = temp->next[i];
+            }
+            update[i] = temp;
+            pos[i] = traversed;
+        }
+    }
+};
+
+#include "ListBaselines.h"
+
+// per-op cost of random insert+delete pairs at size n
+void benchmark(int n,int ops){
+    mt19937 rng(99);
+    LinkedListNode* head = NULL;
+    IndexableSkipList list;
+    for(int i=0;i<n;i++){
+        insertAt(head,i,1);
+        list.insertAtHead(i);
+    }
+
+    vector<int> positions(ops);
+    for(int i=0;i<ops;i++) positions[i] = rng() % n + 1;
+
+    auto t0 = chrono::high_resolution_clock::now();
+    for(int i=0;i<ops;i++){
+        insertAt(head,i,positions[i]);
+        deleteAt(head,positions[i]);
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    for(int i=0;i<ops;i++){
+        list.insertAtMiddle(i,positions[i]);
+        list.deleteNode(positions[i]);
+    }
+    auto t2 = chrono::high_resolution_clock::now();
+
+    double plain = chrono::duration<double,nano>(t1-t0).count()/(2*ops);
+    double skip = chrono::duration<double,nano>(t2-t1).count()/(2*ops);
+    cout<<"n = "<<n<<": plain "<<plain<<" ns/op, skip list "<<skip<<" ns/op"
+        <<(skip < plain ? "  <- skip list faster" : "")<<endl;
+
+    deleteAll(head);
+}
+
+int main(){
+
+    IndexableSkipList list;
+    for(int i=1;i<=10;i++){
+        list.insertAtTail(i*10);
+    }
+    list.insertAtHead(5);
+    list.insertAtMiddle(55,7);
+    list.print();
+    list.deleteNode(1);
+    list.deleteNode(list.len());
+    list.deleteNode(6);
+    list.print();
+    int value = 0;
+    cout<<"len: "<<list.len();
+    if(list.get(4,value)) cout<<", 4th: "<<value;
+    cout<<", 0th present: "<<list.get(0,value)<<", past the end present: "<<list.get(list.len()+1,value)<<endl;
+    cout<<"---------------"<<endl;
+
+    // crossover: the plain list only wins below a couple of hundred elements
+    int sizes[] = {8, 16, 32, 64, 128, 256, 1024, 16384, 262144};
+    for(int n : sizes){
+        benchmark(n,max(1000,4000000/n));
+    }
+    return 0;
+}
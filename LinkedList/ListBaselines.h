@@ -0,0 +1,116 @@
+#ifndef LIST_BASELINES_H
+#define LIST_BASELINES_H
+
+// The plain pointer lists of SinglyLinkedList.cpp and DoublyLinkedList.cpp,
+// reduced to the positional insert/delete the benchmarks of the faster list
+// variants compare against. Every node is its own new; positions are
+// 1-based and every operation walks from head.
+
+class LinkedListNode{
+    public:
+        int data;
+        LinkedListNode* next;
+
+    LinkedListNode(int data){
+        this->data = data;
+        this->next = NULL;
+    }
+};
+
+inline void insertAt(LinkedListNode* &head,int d,int n){
+    LinkedListNode* node = new LinkedListNode(d);
+    if(n == 1){
+        node->next = head;
+        head = node;
+        return;
+    }
+    LinkedListNode* temp = head;
+    for(int i=1;i<n-1;i++){
+        temp = temp->next;
+    }
+    node->next = temp->next;
+    temp->next = node;
+}
+
+inline void deleteAt(LinkedListNode* &head,int n){
+    LinkedListNode* curr = head;
+    if(n == 1){
+        head = head->next;
+        delete curr;
+        return;
+    }
+    LinkedListNode* prev = NULL;
+    for(int i=1;i<n;i++){
+        prev = curr;
+        curr = curr->next;
+    }
+    prev->next = curr->next;
+    delete curr;
+}
+
+inline void deleteAll(LinkedListNode* &head){
+    while(head){
+        LinkedListNode* next = head->next;
+        delete head;
+        head = next;
+    }
+}
+
+class DoublyLinkedList{
+    public:
+        int data;
+        DoublyLinkedList* prev;
+        DoublyLinkedList* next;
+
+    DoublyLinkedList(int d){
+        this->data = d;
+        this->next = NULL;
+        this->prev = NULL;
+    }
+};
+
+inline void insertAt(int n,int d,DoublyLinkedList* &head,DoublyLinkedList* &tail){
+    DoublyLinkedList* newNode = new DoublyLinkedList(d);
+    if(head == NULL){
+        head = tail = newNode;
+        return;
+    }
+    if(n == 1){
+        newNode->next = head;
+        head->prev = newNode;
+        head = newNode;
+        return;
+    }
+    DoublyLinkedList* temp = head;
+    for(int i=1;i<n-1;i++){
+        temp = temp->next;
+    }
+    newNode->next = temp->next;
+    newNode->prev = temp;
+    if(temp->next) temp->next->prev = newNode;
+    else tail = newNode;
+    temp->next = newNode;
+}
+
+inline void deleteAt(int pos,DoublyLinkedList* &head,DoublyLinkedList* &tail){
+    DoublyLinkedList* curr = head;
+    for(int i=1;i<pos;i++){
+        curr = curr->next;
+    }
+    if(curr->prev) curr->prev->next = curr->next;
+    else head = curr->next;
+    if(curr->next) curr->next->prev = curr->prev;
+    else tail = curr->prev;
+    delete curr;
+}
+
+inline void deleteAll(DoublyLinkedList* &head,DoublyLinkedList* &tail){
+    while(head){
+        DoublyLinkedList* next = head->next;
+        delete head;
+        head = next;
+    }
+    tail = NULL;
+}
+
+#endif
@@ -0,0 +1,436 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<atomic>
+#include<thread>
+#include<mutex>
+#include<chrono>
+#include<random>
+#include<cstdint>
+using namespace std;
+
+// Lock-free sorted set of ints (Harris' marked next pointers). The low bit
+// of a node's next link marks the node as logically deleted; any traversal
+// that meets a marked node unlinks it.
+// Memory is reclaimed with epochs: every operation announces the global
+// epoch it started in, and an unlinked node is freed only once the epoch
+// has moved two steps past the one it was retired in, by which point no
+// operation that could still see it is running. That costs one fence per
+// operation (the seq_cst fence in enter()) instead of one per visited node
+// (hazard pointers); the price is that a thread stalled inside an operation
+// holds back reclamation. A thread that exits hands the nodes it retired
+// but could not free yet to the list's orphan pile, which the remaining
+// threads free once the epoch allows.
+
+const int MAX_THREADS = 128;
+const uint64_t IDLE = ~0ULL;
+
+class LockFreeNode{
+    public:
+        int key;
+        atomic<uintptr_t> next;
+
+    LockFreeNode(int key){
+        this->key = key;
+        this->next.store(0);
+    }
+};
+
+// every live thread owns one slot index for as long as it runs
+atomic<bool> slotTaken[MAX_THREADS];
+
+class ThreadSlot{
+    public:
+        int id;
+
+    ThreadSlot(){
+        id = -1;
+        for(int i=0;i<MAX_THREADS && id == -1;i++){
+            bool expected = false;
+            if(slotTaken[i].compare_exchange_strong(expected,true)){
+                id = i;
+            }
+        }
+        if(id == -1){
+            cerr<<"LockFreeList: more than "<<MAX_THREADS<<" threads"<<endl;
+            abort();
+        }
+    }
+
+    ~ThreadSlot();
+};
+
+thread_local ThreadSlot threadSlot;
+
+// every list alive, so an exiting thread can find the nodes it retired
+class LockFreeList;
+mutex liveListsLock;
+vector<LockFreeList*> liveLists;
+
+class LockFreeList{
+    public:
+        struct alignas(64) Slot{
+            atomic<uint64_t> active;
+            vector<pair<uint64_t,LockFreeNode*>> retired;
+        };
+
+        atomic<uintptr_t> head;
+        atomic<uint64_t> epoch;
+        Slot slots[MAX_THREADS];
+
+        // retired nodes of threads that have exited
+        mutex orphanLock;
+        vector<pair<uint64_t,LockFreeNode*>> orphans;
+
+    LockFreeList(){
+        head.store(0);
+        epoch.store(0);
+        for(Slot &s : slots){
+            s.active.store(IDLE);
+        }
+        lock_guard<mutex> lock(liveListsLock);
+        liveLists.push_back(this);
+    }
+
+    // only safe once no other thread uses the list
+    ~LockFreeList(){
+        {
+            lock_guard<mutex> lock(liveListsLock);
+            liveLists.erase(std::find(liveLists.begin(),liveLists.end(),this));
+        }
+        LockFreeNode* temp = ptr(head.load());
+        while(temp){
+            LockFreeNode* next = ptr(temp->next.load());
+            delete temp;
+            temp = next;
+        }
+        for(Slot &s : slots){
+            for(auto &r : s.retired) delete r.second;
+        }
+        for(auto &r : orphans) delete r.second;
+    }
+
+    // called by a thread on exit: its slot index goes to the next thread,
+    // its pending nodes go to the orphan pile
+    void abandon(int id){
+        Slot &s = slots[id];
+        if(s.retired.empty()) return;
+        lock_guard<mutex> lock(orphanLock);
+        orphans.insert(orphans.end(),s.retired.begin(),s.retired.end());
+        s.retired.clear();
+    }
+
+    size_t orphanCount(){
+        lock_guard<mutex> lock(orphanLock);
+        return orphans.size();
+    }
+
+    bool insert(int key){
+        Slot &me = enter();
+        LockFreeNode* node = new LockFreeNode(key);
+        atomic<uintptr_t>* prev;
+        LockFreeNode* curr;
+
+        while(true){
+            if(find(me,key,prev,curr)){
+                delete node;
+                exit(me);
+                return false;
+            }
+            node->next.store((uintptr_t)curr);
+            uintptr_t expected = (uintptr_t)curr;
+            if(prev->compare_exchange_strong(expected,(uintptr_t)node)){
+                exit(me);
+                return true;
+            }
+        }
+    }
+
+    bool erase(int key){
+        Slot &me = enter();
+        atomic<uintptr_t>* prev;
+        LockFreeNode* curr;
+
+        while(true){
+            if(!find(me,key,prev,curr)){
+                exit(me);
+                return false;
+            }
+            // logical delete: mark curr's next link
+            uintptr_t next = curr->next.load();
+            if(next & 1){
+                continue;
+            }
+            if(!curr->next.compare_exchange_strong(next,next | 1)){
+                continue;
+            }
+            // physical delete; if it races, the next find() finishes the job
+            uintptr_t expected = (uintptr_t)curr;
+            if(prev->compare_exchange_strong(expected,next)){
+                retire(me,curr);
+            }
+            else{
+                find(me,key,prev,curr);
+            }
+            exit(me);
+            return true;
+        }
+    }
+
+    bool contains(int key){
+        Slot &me = enter();
+        atomic<uintptr_t>* prev;
+        LockFreeNode* curr;
+
+        bool found = find(me,key,prev,curr);
+        exit(me);
+        return found;
+    }
+
+    // not linearizable against concurrent writers, for tests and printing
+    vector<int> snapshot(){
+        vector<int> keys;
+        for(LockFreeNode* temp = ptr(head.load()); temp; temp = ptr(temp->next.load())){
+            if(!(temp->next.load() & 1)) keys.push_back(temp->key);
+        }
+        return keys;
+    }
+
+    private:
+    static LockFreeNode* ptr(uintptr_t link){
+        return (LockFreeNode*)(link & ~(uintptr_t)1);
+    }
+
+    Slot& enter(){
+        Slot &me = slots[threadSlot.id];
+        me.active.store(epoch.load(),memory_order_relaxed);
+        // StoreLoad: the announcement must be visible to tryAdvance() before
+        // any link is read, or the epoch could move past a node this
+        // operation is about to reach
+        atomic_thread_fence(memory_order_seq_cst);
+        return me;
+    }
+
+    void exit(Slot &me){
+        me.active.store(IDLE,memory_order_release);
+    }
+
+    // positions prev/curr so that curr is the first node with key >= key,
+    // unlinking marked nodes on the way
+    bool find(Slot &me,int key,atomic<uintptr_t>* &prev,LockFreeNode* &curr){
+    retry:
+        prev = &head;
+        curr = ptr(prev->load(memory_order_acquire));
+
+        while(true){
+            if(curr == NULL) return false;
+
+            uintptr_t link = curr->next.load(memory_order_acquire);
+            LockFreeNode* next = ptr(link);
+
+            if(link & 1){
+                // fails if prev itself got marked or moved on: start over
+                uintptr_t expected = (uintptr_t)curr;
+                if(!prev->compare_exchange_strong(expected,(uintptr_t)next)) goto retry;
+                retire(me,curr);
+            }
+            else{
+                if(curr->key >= key) return curr->key == key;
+                prev = &curr->next;
+            }
+            curr = next;
+        }
+    }
+
+    void retire(Slot &me,LockFreeNode* node){
+        me.retired.push_back({epoch.load(),node});
+        if(me.retired.size() % 64 == 0){
+            tryAdvance();
+            collect(me);
+        }
+    }
+
+    // the epoch moves on once every thread inside an operation has seen it
+    void tryAdvance(){
+        uint64_t e = epoch.load();
+        for(Slot &s : slots){
+            uint64_t a = s.active.load();
+            if(a != IDLE && a != e) return;
+        }
+        epoch.compare_exchange_strong(e,e+1);
+    }
+
+    // retired is in epoch order, so the safe nodes form a prefix
+    void collect(Slot &me){
+        uint64_t e = epoch.load();
+        size_t freed = 0;
+        while(freed < me.retired.size() && me.retired[freed].first + 2 <= e){
+            delete me.retired[freed].second;
+            freed++;
+        }
+        me.retired.erase(me.retired.begin(),me.retired.begin()+freed);
+
+        // orphans come from several threads and are not in epoch order;
+        // whoever finds the pile busy leaves it for the next collect
+        unique_lock<mutex> lock(orphanLock,try_to_lock);
+        if(!lock.owns_lock() || orphans.empty()) return;
+        size_t kept = 0;
+        for(auto &r : orphans){
+            if(r.first + 2 <= e) delete r.second;
+            else orphans[kept++] = r;
+        }
+        orphans.resize(kept);
+    }
+};
+
+ThreadSlot::~ThreadSlot(){
+    {
+        lock_guard<mutex> lock(liveListsLock);
+        for(LockFreeList* list : liveLists) list->abandon(id);
+    }
+    slotTaken[id].store(false);
+}
+
+// the current approach: sorted singly list behind one mutex
+class LinkedListNode{
+    public:
+        int data;
+        LinkedListNode* next;
+
+    LinkedListNode(int data){
+        this->data = data;
+        this->next = NULL;
+    }
+};
+
+class MutexList{
+    public:
+        LinkedListNode* head;
+        mutex m;
+
+    MutexList(){
+        head = NULL;
+    }
+
+    ~MutexList(){
+        while(head){
+            LinkedListNode* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    bool insert(int key){
+        lock_guard<mutex> lock(m);
+        LinkedListNode** link = &head;
+        while(*link && (*link)->data < key) link = &(*link)->next;
+        if(*link && (*link)->data == key) return false;
+        LinkedListNode* node = new LinkedListNode(key);
+        node->next = *link;
+        *link = node;
+        return true;
+    }
+
+    bool erase(int key){
+        lock_guard<mutex> lock(m);
+        LinkedListNode** link = &head;
+        while(*link && (*link)->data < key) link = &(*link)->next;
+        if(*link == NULL || (*link)->data != key) return false;
+        LinkedListNode* temp = *link;
+        *link = temp->next;
+        delete temp;
+        return true;
+    }
+
+    bool contains(int key){
+        lock_guard<mutex> lock(m);
+        LinkedListNode* temp = head;
+        while(temp && temp->data < key) temp = temp->next;
+        return temp && temp->data == key;
+    }
+};
+
+// 10% insert, 10% erase, 80% contains over a fixed key range
+template<typename List>
+double throughput(int threads,int keyRange,int opsPerThread){
+    List list;
+    for(int k=0;k<keyRange;k+=2) list.insert(k);
+
+    // results are summed so the compiler cannot drop the read-only calls
+    atomic<long long> hits(0);
+    vector<thread> pool;
+    auto start = chrono::high_resolution_clock::now();
+    for(int t=0;t<threads;t++){
+        pool.push_back(thread([&list,&hits,t,keyRange,opsPerThread](){
+            mt19937 rng(t+1);
+            long long local = 0;
+            for(int i=0;i<opsPerThread;i++){
+                int key = rng() % keyRange;
+                int op = rng() % 10;
+                if(op == 0) local += list.insert(key);
+                else if(op == 1) local += list.erase(key);
+                else local += list.contains(key);
+            }
+            hits += local;
+        }));
+    }
+    for(thread &th : pool) th.join();
+    auto end = chrono::high_resolution_clock::now();
+    if(hits.load() < 0) cout<<"unreachable"<<endl;
+
+    return threads * (double)opsPerThread / chrono::duration<double>(end-start).count() / 1e6;
+}
+
+int main(){
+
+    LockFreeList list;
+    int keys[] = {30, 10, 50, 20, 40, 10};
+    for(int k : keys){
+        cout<<"insert "<<k<<": "<<list.insert(k)<<endl;
+    }
+    cout<<"erase 20: "<<list.erase(20)<<", erase 25: "<<list.erase(25)<<endl;
+    cout<<"contains 40: "<<list.contains(40)<<", contains 20: "<<list.contains(20)<<endl;
+    for(int k : list.snapshot()) cout<<k<<" ";
+    cout<<endl;
+
+    // every thread inserts and erases its own keys; afterwards only the
+    // keys each thread left behind must remain
+    {
+        LockFreeList shared;
+        vector<thread> pool;
+        for(int t=0;t<8;t++){
+            pool.push_back(thread([&shared,t](){
+                for(int i=0;i<2000;i++){
+                    int key = i*8 + t;
+                    shared.insert(key);
+                    if(i % 2) shared.erase(key);
+                }
+            }));
+        }
+        for(thread &th : pool) th.join();
+        vector<int> left = shared.snapshot();
+        bool ok = left.size() == 8000u;
+        for(int k : left) ok = ok && ((k/8) % 2 == 0);
+        cout<<"concurrent insert/erase check: "<<(ok ? "ok" : "FAILED")<<endl;
+
+        // the exited workers' unfreed nodes now wait on the orphan pile;
+        // churn from this thread advances the epoch and frees them
+        size_t orphaned = shared.orphanCount();
+        for(int i=0;i<1000;i++){
+            shared.insert(-1-i);
+            shared.erase(-1-i);
+        }
+        cout<<"retired nodes left by exited threads: "<<orphaned
+            <<", after more work here: "<<shared.orphanCount()<<endl;
+    }
+    cout<<"---------------"<<endl;
+
+    int threadCounts[] = {1, 2, 4, 8};
+    cout<<"Mops/s, key range 1000, 80% contains"<<endl;
+    for(int threads : threadCounts){
+        double locked = throughput<MutexList>(threads,1000,50000);
+        double lockFree = throughput<LockFreeList>(threads,1000,50000);
+        cout<<threads<<" threads: lock-free "<<lockFree<<", mutex "<<locked<<endl;
+    }
+    return 0;
+}
@@ -10,9 +10,14 @@
  */
 class Solution {
 public:
+    // loser tree over the k list heads: tree[0] is the current winner,
+    // tree[1..k-1] hold the loser of each match. Leaf i sits at index k+i.
+    vector<int> tree;
+    vector<ListNode*> heads;
+
     ListNode* mergeTwoLists(ListNode* list1, ListNode* list2) {
-        ListNode* dummy=new ListNode(-1);
-        ListNode* temp=dummy;
+        ListNode dummy(-1);
+        ListNode* temp=&dummy;
 
         while(list1!=NULL && list2!=NULL){
             if(list1->val <= list2->val){
@@ -31,7 +36,7 @@ public:
         else{
             temp->next=list2;
         }
-        return dummy->next;
+        return dummy.next;
     }
     ListNode* mergeKLL(vector<ListNode*>& lists,int start,int end){
         if(start==end){
@@ -45,10 +50,136 @@ public:
         ListNode* right=mergeKLL(lists,mid+1,end);
         return mergeTwoLists(left,right);
     }
+    // an exhausted list counts as +infinity; ties go to the lower index
+    bool beats(int a, int b){
+        if(heads[a]==NULL) return false;
+        if(heads[b]==NULL) return true;
+        return heads[a]->val < heads[b]->val || (heads[a]->val == heads[b]->val && a < b);
+    }
+    int buildTree(int node, int k){
+        if(node>=k){
+            return node-k;
+        }
+        int left=buildTree(2*node,k);
+        int right=buildTree(2*node+1,k);
+        if(beats(left,right)){
+            tree[node]=right;
+            return left;
+        }
+        tree[node]=left;
+        return right;
+    }
+    // one pass over all k lists, log k comparisons per node, no allocation per node
+    ListNode* mergeKListsLoserTree(vector<ListNode*>& lists) {
+        int k=lists.size();
+        if(k==0){
+            return NULL;
+        }
+        heads.assign(lists.begin(),lists.end());
+        tree.assign(k,0);
+        tree[0]=(k==1) ? 0 : buildTree(1,k);
+
+        ListNode dummy(-1);
+        ListNode* temp=&dummy;
+
+        while(heads[tree[0]]!=NULL){
+            int winner=tree[0];
+            temp->next=heads[winner];
+            temp=temp->next;
+            heads[winner]=heads[winner]->next;
+
+            // replay the matches from the winner's leaf up to the root
+            for(int t=(winner+k)/2;t>0;t/=2){
+                if(beats(tree[t],winner)){
+                    swap(tree[t],winner);
+                }
+            }
+            tree[0]=winner;
+        }
+        temp->next=NULL;
+        return dummy.next;
+    }
+    // all workers, the calling thread included, wait here between rounds
+    struct RoundBarrier {
+        mutex m;
+        condition_variable cv;
+        int parties;
+        int waiting=0;
+        int generation=0;
+
+        RoundBarrier(int parties) : parties(parties) {}
+
+        void wait(){
+            unique_lock<mutex> lock(m);
+            int gen=generation;
+            if(++waiting==parties){
+                waiting=0;
+                generation++;
+                cv.notify_all();
+                return;
+            }
+            cv.wait(lock,[&](){ return gen!=generation; });
+        }
+    };
+    // pairwise rounds: every pair in a round is disjoint, so the pairs are
+    // split across threads; log k rounds in total. The threads are started
+    // once and meet at a barrier after each round, reading one buffer and
+    // writing the other.
+    ListNode* mergeKListsParallel(vector<ListNode*>& lists, int threads) {
+        if(lists.empty()){
+            return NULL;
+        }
+        int k=lists.size();
+        vector<ListNode*> buf[2]={vector<ListNode*>(lists.begin(),lists.end()), vector<ListNode*>(k)};
+        int workers=max(1,min(threads,k/2));
+        RoundBarrier barrier(workers);
+
+        auto work=[&](int w){
+            int size=k;
+            for(int round=0;size>1;round++){
+                vector<ListNode*> &curr=buf[round%2];
+                vector<ListNode*> &next=buf[(round+1)%2];
+                int pairs=size/2;
+                for(int i=w;i<pairs;i+=workers){
+                    next[i]=mergeTwoLists(curr[2*i],curr[2*i+1]);
+                }
+                if(w==0 && size%2==1){
+                    next[pairs]=curr[size-1];
+                }
+                size=(size+1)/2;
+                barrier.wait();
+            }
+        };
+        vector<thread> pool;
+        for(int w=1;w<workers;w++){
+            pool.push_back(thread(work,w));
+        }
+        work(0);
+        for(thread &t : pool){
+            t.join();
+        }
+        int rounds=0;
+        for(int size=k;size>1;size=(size+1)/2){
+            rounds++;
+        }
+        return buf[rounds%2][0];
+    }
+    // From MergeKSortedLLBenchmark.cpp: the loser tree touches every node
+    // once, pairwise merging log k times, so the tree wins once the lists
+    // outgrow the cache (2M nodes: 1.25x at k=16, 2.5x at k=64; 20M nodes:
+    // 1.4x at k=16, 4.5x at k=512). Below k=16 the tree's per-node replay
+    // costs more than it saves. Inputs that fit in cache (200K nodes) are
+    // the exception: there pairwise stays 20-40% ahead at every k, a few
+    // milliseconds against seconds saved on large inputs.
+    static constexpr int LOSER_TREE_MIN_K = 16;
+
     ListNode* mergeKLists(vector<ListNode*>& lists) {
         if(lists.empty()){
             return NULL;
         }
+        if((int)lists.size() >= LOSER_TREE_MIN_K){
+            return mergeKListsLoserTree(lists);
+        }
         return mergeKLL(lists,0,lists.size()-1);
     }
 };
\ No newline at end of file
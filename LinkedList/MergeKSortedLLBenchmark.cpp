@@ -0,0 +1,87 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<chrono>
+#include<random>
+#include<cstdlib>
+using namespace std;
+
+struct ListNode {
+    int val;
+    ListNode *next;
+    ListNode() : val(0), next(nullptr) {}
+    ListNode(int x) : val(x), next(nullptr) {}
+    ListNode(int x, ListNode *next) : val(x), next(next) {}
+};
+
+#include "MergeKSortedLL.cpp"
+
+// Times pairwise recursive merging, the loser tree and the parallel rounds
+// on k sorted lists holding `total` nodes between them.
+
+// all nodes come from one array so building the input does not dominate
+vector<ListNode*> buildLists(vector<ListNode> &pool,int k,long long total){
+    mt19937 rng(k);
+    vector<int> vals(total);
+    for(auto &v : vals) v = rng() % 1000000000;
+
+    vector<ListNode*> lists(k,NULL);
+    vector<ListNode*> tails(k,NULL);
+    vector<int> owner(total);
+    for(long long i=0;i<total;i++) owner[i] = rng() % k;
+    sort(vals.begin(),vals.end());
+
+    for(long long i=0;i<total;i++){
+        ListNode* node = &pool[i];
+        node->val = vals[i];
+        node->next = NULL;
+        int o = owner[i];
+        if(tails[o]) tails[o]->next = node;
+        else lists[o] = node;
+        tails[o] = node;
+    }
+    return lists;
+}
+
+bool sortedAndComplete(ListNode* head,long long total){
+    long long cnt = 0;
+    while(head){
+        cnt++;
+        if(head->next && head->next->val < head->val) return false;
+        head = head->next;
+    }
+    return cnt == total;
+}
+
+int main(int argc,char** argv){
+
+    // e.g. ./a.out 100000000 for the full-size run
+    long long total = argc > 1 ? atoll(argv[1]) : 2000000;
+    int threads = max(1u,thread::hardware_concurrency());
+    vector<ListNode> pool(total);
+
+    int ks[] = {2, 8, 16, 64, 512, 4096, 10000};
+    cout<<total<<" nodes, "<<threads<<" threads"<<endl;
+    for(int k : ks){
+        Solution s;
+        double ms[3];
+        bool ok = true;
+        for(int mode=0;mode<3;mode++){
+            vector<ListNode*> lists = buildLists(pool,k,total);
+            auto start = chrono::high_resolution_clock::now();
+            ListNode* head;
+            if(mode == 0) head = s.mergeKLL(lists,0,lists.size()-1);
+            else if(mode == 1) head = s.mergeKListsLoserTree(lists);
+            else head = s.mergeKListsParallel(lists,threads);
+            auto end = chrono::high_resolution_clock::now();
+            ms[mode] = chrono::duration<double,milli>(end-start).count();
+            ok = ok && sortedAndComplete(head,total);
+        }
+        cout<<"k = "<<k<<": pairwise "<<ms[0]<<" ms, loser tree "<<ms[1]
+            <<" ms, parallel rounds "<<ms[2]<<" ms"<<(ok ? "" : "  WRONG")<<endl;
+    }
+    return 0;
+}
@@ -27,8 +27,8 @@ public:
             return left;
         }
 
-        ListNode* ans = new ListNode(-1);
-        ListNode* temp = ans;
+        ListNode ans(-1);
+        ListNode* temp = &ans;
 
         while(left && right){
             if(left->val < right->val){
@@ -52,10 +52,9 @@ public:
             temp = right;
             right = right->next;
         }
-        ans=ans->next;
-        return ans;
+        return ans.next;
     }
-    ListNode* sortList(ListNode* head) {
+    ListNode* sortListTopDown(ListNode* head) {
         if(head == NULL || head->next == NULL){
             return head;
         }
@@ -65,11 +64,116 @@ public:
         ListNode* right = mid->next;
         mid->next = NULL;
 
-        left = sortList(left);
-        right = sortList(right);
+        left = sortListTopDown(left);
+        right = sortListTopDown(right);
 
         ListNode* result = merge(left,right);
 
         return result;
     }
+
+    // cuts the first n nodes off head and returns the rest
+    ListNode* split(ListNode* head, int n){
+        for(int i=1; head && i<n; i++){
+            head = head->next;
+        }
+        if(head == NULL){
+            return NULL;
+        }
+        ListNode* rest = head->next;
+        head->next = NULL;
+        return rest;
+    }
+
+    // merges left and right after tail, returns the new tail
+    ListNode* mergeAfter(ListNode* left, ListNode* right, ListNode* tail){
+        while(left && right){
+            if(right->val < left->val){
+                tail->next = right;
+                right = right->next;
+            }
+            else{
+                tail->next = left;
+                left = left->next;
+            }
+            tail = tail->next;
+        }
+        tail->next = left ? left : right;
+        while(tail->next){
+            tail = tail->next;
+        }
+        return tail;
+    }
+
+    // bottom-up: merge runs of 1, 2, 4, ... in place, O(1) extra space
+    ListNode* sortListBottomUp(ListNode* head) {
+        int n = 0;
+        for(ListNode* temp = head; temp; temp = temp->next){
+            n++;
+        }
+
+        ListNode dummy(-1);
+        dummy.next = head;
+
+        for(int step = 1; step < n; step *= 2){
+            ListNode* tail = &dummy;
+            ListNode* curr = dummy.next;
+            while(curr){
+                ListNode* left = curr;
+                ListNode* right = split(left, step);
+                curr = split(right, step);
+                tail = mergeAfter(left, right, tail);
+            }
+        }
+        return dummy.next;
+    }
+
+    // gathers the nodes, LSD radix sorts the pointers by value (3 passes of
+    // 11 bits, sign bit flipped so negatives order first) and relinks them
+    ListNode* sortListRadix(ListNode* head, int n) {
+        if(n < 2){
+            return head;
+        }
+        vector<ListNode*> nodes(n), buffer(n);
+        int i = 0;
+        for(ListNode* temp = head; temp; temp = temp->next){
+            nodes[i++] = temp;
+        }
+
+        for(int shift = 0; shift < 32; shift += 11){
+            int count[2049] = {0};
+            for(ListNode* node : nodes){
+                unsigned key = ((unsigned)node->val ^ 0x80000000u) >> shift & 2047;
+                count[key+1]++;
+            }
+            for(int b = 0; b < 2048; b++){
+                count[b+1] += count[b];
+            }
+            for(ListNode* node : nodes){
+                unsigned key = ((unsigned)node->val ^ 0x80000000u) >> shift & 2047;
+                buffer[count[key]++] = node;
+            }
+            nodes.swap(buffer);
+        }
+
+        for(int j = 0; j+1 < n; j++){
+            nodes[j]->next = nodes[j+1];
+        }
+        nodes[n-1]->next = NULL;
+        return nodes[0];
+    }
+
+    // below this length the in-place merge sort wins, see MergeSortLLBenchmark.cpp
+    static const int RADIX_THRESHOLD = 96;
+
+    ListNode* sortList(ListNode* head) {
+        int n = 0;
+        for(ListNode* temp = head; temp; temp = temp->next){
+            n++;
+        }
+        if(n < RADIX_THRESHOLD){
+            return sortListBottomUp(head);
+        }
+        return sortListRadix(head, n);
+    }
 };
\ No newline at end of file
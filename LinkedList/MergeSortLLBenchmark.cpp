@@ -0,0 +1,77 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<chrono>
+#include<random>
+using namespace std;
+
+struct ListNode {
+    int val;
+    ListNode *next;
+    ListNode() : val(0), next(nullptr) {}
+    ListNode(int x) : val(x), next(nullptr) {}
+    ListNode(int x, ListNode *next) : val(x), next(next) {}
+};
+
+#include "MergeSortLL.cpp"
+
+// Times the three sorts across list sizes and reports which one wins;
+// Solution::RADIX_THRESHOLD is picked from this table.
+
+// nodes are linked in shuffled memory order, like a list after some churn
+ListNode* buildList(vector<ListNode> &pool,mt19937 &rng){
+    vector<ListNode*> order(pool.size());
+    for(size_t i=0;i<pool.size();i++){
+        pool[i].val = (int)rng();
+        order[i] = &pool[i];
+    }
+    shuffle(order.begin(),order.end(),rng);
+    for(size_t i=0;i+1<order.size();i++){
+        order[i]->next = order[i+1];
+    }
+    order.back()->next = NULL;
+    return order[0];
+}
+
+bool isSorted(ListNode* head){
+    while(head && head->next){
+        if(head->next->val < head->val) return false;
+        head = head->next;
+    }
+    return true;
+}
+
+int main(){
+
+    int sizes[] = {8, 16, 32, 64, 128, 1024, 16384, 262144, 1000000};
+    const char* names[] = {"top-down", "bottom-up", "radix"};
+
+    for(int n : sizes){
+        int rounds = max(1,1000000/n);
+        vector<ListNode> pool(n);
+        double ns[3];
+        bool ok = true;
+
+        for(int mode=0;mode<3;mode++){
+            mt19937 rng(n);
+            double elapsed = 0;
+            for(int r=0;r<rounds;r++){
+                ListNode* head = buildList(pool,rng);
+                Solution s;
+                auto start = chrono::high_resolution_clock::now();
+                if(mode == 0) head = s.sortListTopDown(head);
+                else if(mode == 1) head = s.sortListBottomUp(head);
+                else head = s.sortListRadix(head,n);
+                auto end = chrono::high_resolution_clock::now();
+                elapsed += chrono::duration<double,nano>(end-start).count();
+                ok = ok && isSorted(head);
+            }
+            ns[mode] = elapsed/((double)rounds*n);
+        }
+
+        int best = min_element(ns,ns+3) - ns;
+        cout<<"n = "<<n<<": top-down "<<ns[0]<<", bottom-up "<<ns[1]<<", radix "<<ns[2]
+            <<" ns/node -> "<<names[best]<<(ok ? "" : "  WRONG")<<endl;
+    }
+    return 0;
+}
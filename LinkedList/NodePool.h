@@ -0,0 +1,136 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <vector>
+
+// Hands out nodes from slabs of SLAB_SIZE nodes and recycles deleted ones
+// through a free list threaded on their next pointers, so churn never
+// reaches malloc once the pool is warm. Node needs a Node(int) constructor
+// and a `next` pointer. Each list file keeps one pool for the whole program
+// and its slabs live until exit or until trim() finds them empty, so a list
+// never outlives its memory; like the list functions themselves it is not
+// thread-safe, and threads sharing lists must serialize their calls.
+
+template<typename Node>
+class NodePool{
+    public:
+        static constexpr int SLAB_SIZE = 4096;
+
+        struct Slab{
+            Node* nodes;
+            int size;
+        };
+
+        std::vector<Slab> slabs;
+        Node* current;
+        Node* freeList;
+        int used;
+        std::size_t bytes;
+
+    NodePool(){
+        bytes = 0;
+        current = NULL;
+        freeList = NULL;
+        used = SLAB_SIZE;
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool(){
+        for(Slab &slab : slabs){
+            ::operator delete(slab.nodes);
+        }
+    }
+
+    Node* allocate(int d){
+        Node* node;
+        if(freeList != NULL){
+            node = freeList;
+            freeList = freeList->next;
+        }
+        else{
+            if(used == SLAB_SIZE){
+                current = static_cast<Node*>(::operator new(SLAB_SIZE * sizeof(Node)));
+                slabs.push_back({current, SLAB_SIZE});
+                bytes += SLAB_SIZE * sizeof(Node);
+                used = 0;
+            }
+            node = current + used;
+            used++;
+        }
+        return new(node) Node(d);
+    }
+
+    // n consecutive, unconstructed nodes in a slab of their own
+    Node* allocateRun(int n){
+        Node* run = static_cast<Node*>(::operator new(n * sizeof(Node)));
+        slabs.push_back({run, n});
+        bytes += n * sizeof(Node);
+        return run;
+    }
+
+    void release(Node* node){
+        node->next = freeList;
+        freeList = node;
+    }
+
+    // the list is already linked, so it goes onto the free list whole
+    void releaseList(Node* head,Node* tail){
+        if(head == NULL) return;
+        tail->next = freeList;
+        freeList = head;
+    }
+
+    // Returns every slab whose nodes are all on the free list to the system
+    // and relinks the rest of the free list in address order, so later
+    // allocations fill the surviving slabs front to back instead of popping
+    // scattered nodes. O(f log f) for f free nodes; meant to run after
+    // something that frees a lot at once, like compact().
+    void trim(){
+        std::vector<Node*> frees;
+        for(Node* node = freeList; node; node = node->next){
+            frees.push_back(node);
+        }
+        std::sort(frees.begin(),frees.end(),std::less<Node*>());
+        std::sort(slabs.begin(),slabs.end(),[](const Slab &a,const Slab &b){
+            return std::less<Node*>()(a.nodes,b.nodes);
+        });
+
+        std::vector<Slab> kept;
+        Node* head = NULL;
+        Node** link = &head;
+        std::size_t f = 0;
+        for(Slab &slab : slabs){
+            // only the handed-out prefix of the current slab can be free
+            int handedOut = slab.nodes == current ? used : slab.size;
+            std::size_t first = f;
+            while(f < frees.size() && std::less<Node*>()(frees[f], slab.nodes + slab.size)){
+                f++;
+            }
+            if(handedOut > 0 && (int)(f - first) == handedOut){
+                if(slab.nodes == current){
+                    current = NULL;
+                    used = SLAB_SIZE;
+                }
+                ::operator delete(slab.nodes);
+                bytes -= slab.size * sizeof(Node);
+                continue;
+            }
+            for(std::size_t i = first; i < f; i++){
+                *link = frees[i];
+                link = &frees[i]->next;
+            }
+            kept.push_back(slab);
+        }
+        *link = NULL;
+        freeList = head;
+        slabs.swap(kept);
+    }
+};
+
+#endif
@@ -33,7 +33,9 @@ public:
         }
         return prev;
     }
-    bool isPalindrome(ListNode* head) {
+    // reverses the second half in place and back again: concurrent readers
+    // see a broken list in between
+    bool isPalindromeInPlace(ListNode* head) {
         if(head == NULL || head->next == NULL) return true;
 
         ListNode* middle = mid(head);
@@ -44,9 +46,11 @@ public:
         
         ListNode* head1 = head;
         ListNode* head2 = middle->next;
+        bool same = true;
         while(head2){
             if(head1->val != head2->val){
-                return false;
+                same = false;
+                break;
             }
             head1 = head1->next;
             head2 = head2->next;
@@ -54,6 +58,69 @@ public:
 
         temp = middle->next;
         middle->next = reverse(temp);
+        return same;
+    }
+
+    // Read-only check, safe for any number of threads on a shared list.
+    // One pass hashes the values forward (Horner) and backward (rising
+    // powers) mod 2^61-1; different hashes reject at once. Equal hashes are
+    // confirmed exactly by comparing the first half, copied maxBuffer
+    // values at a time (at least one), with the mirrored part of the second
+    // half. The first-half cursor carries over from chunk to chunk; the
+    // mirror of each chunk is reached by walking on from there, so the
+    // check is one pass when half the list fits in the buffer and about
+    // n*n/(4*maxBuffer) steps otherwise.
+    static constexpr uint64_t MOD = (1ULL << 61) - 1;
+    static constexpr uint64_t BASE = 1000003;
+    static constexpr size_t VERIFY_BUFFER = 1 << 20;
+
+    static uint64_t mulMod(uint64_t a, uint64_t b){
+        unsigned __int128 p = (unsigned __int128)a * b;
+        uint64_t r = (uint64_t)(p & MOD) + (uint64_t)(p >> 61);
+        return r >= MOD ? r - MOD : r;
+    }
+
+    bool isPalindromeReadOnly(ListNode* head, size_t maxBuffer) {
+        uint64_t forward = 0;
+        uint64_t backward = 0;
+        uint64_t power = 1;
+        size_t n = 0;
+
+        for(ListNode* curr = head; curr; curr = curr->next){
+            uint64_t v = (uint64_t)(uint32_t)curr->val + 1;
+            forward = mulMod(forward, BASE) + v;
+            if(forward >= MOD) forward -= MOD;
+            backward += mulMod(v, power);
+            if(backward >= MOD) backward -= MOD;
+            power = mulMod(power, BASE);
+            n++;
+        }
+        if(forward != backward) return false;
+
+        maxBuffer = max(maxBuffer, (size_t)1);
+        vector<int> buffer;
+        size_t half = n/2;
+        ListNode* front = head;
+        for(size_t start=0; start<half; start+=maxBuffer){
+            size_t len = min(maxBuffer, half-start);
+
+            buffer.clear();
+            for(size_t i=0;i<len;i++){
+                buffer.push_back(front->val);
+                front = front->next;
+            }
+            // mirror of [start, start+len) is [n-start-len, n-start)
+            ListNode* curr = front;
+            for(size_t i=start+len; i<n-start-len; i++) curr = curr->next;
+            for(size_t i=len; i>0; i--){
+                if(curr->val != buffer[i-1]) return false;
+                curr = curr->next;
+            }
+        }
         return true;
     }
+
+    bool isPalindrome(ListNode* head) {
+        return isPalindromeReadOnly(head, VERIFY_BUFFER);
+    }
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<thread>
+#include<atomic>
+#include<chrono>
+#include<random>
+#include<cstdint>
+#include<cstdlib>
+using namespace std;
+
+struct ListNode {
+    int val;
+    ListNode *next;
+    ListNode() : val(0), next(nullptr) {}
+    ListNode(int x) : val(x), next(nullptr) {}
+    ListNode(int x, ListNode *next) : val(x), next(next) {}
+};
+
+#include "Palindrome.cpp"
+
+// Checks per second of the in-place palindrome check against the read-only
+// one, single threaded and with several threads sharing one list (which
+// only the read-only check allows).
+
+// n nodes in shuffled memory order; a palindrome, or one with a single
+// value changed at `broken`
+ListNode* build(vector<ListNode> &pool,int broken,mt19937 &rng){
+    int n = pool.size();
+    vector<ListNode*> order(n);
+    for(int i=0;i<n;i++) order[i] = &pool[i];
+    shuffle(order.begin(),order.end(),rng);
+    for(int i=0;i<(n+1)/2;i++){
+        order[i]->val = order[n-1-i]->val = rng() % 100;
+    }
+    if(broken >= 0) order[broken]->val += 100;
+    for(int i=0;i+1<n;i++) order[i]->next = order[i+1];
+    order[n-1]->next = NULL;
+    return order[0];
+}
+
+// checks per second, every thread running `repeats` checks
+template<typename Check>
+double rate(Check check,int threads,int repeats){
+    atomic<int> wrong(0);
+    auto start = chrono::high_resolution_clock::now();
+    vector<thread> pool;
+    for(int t=0;t<threads;t++){
+        pool.push_back(thread([&](){
+            for(int r=0;r<repeats;r++){
+                if(!check()) wrong++;
+            }
+        }));
+    }
+    for(thread &th : pool) th.join();
+    auto end = chrono::high_resolution_clock::now();
+    if(wrong.load()) cout<<"  WRONG";
+    return threads * (double)repeats / chrono::duration<double>(end-start).count();
+}
+
+int main(int argc,char** argv){
+
+    int threads = max(1u,thread::hardware_concurrency());
+    int sizes[] = {1000, 100000, argc > 1 ? atoi(argv[1]) : 2000000};
+    Solution s;
+
+    // tiny buffers, including 0 (treated as 1), on odd and even lengths
+    for(int n=1;n<=9;n++){
+        vector<ListNode> pool(n);
+        mt19937 rng(n);
+        ListNode* head = build(pool,-1,rng);
+        for(size_t b=0;b<=3;b++){
+            if(!s.isPalindromeReadOnly(head,b)) cout<<"WRONG n="<<n<<" buffer "<<b<<endl;
+        }
+        if(n < 2) continue;
+        head = build(pool,0,rng);
+        for(size_t b=0;b<=3;b++){
+            if(s.isPalindromeReadOnly(head,b)) cout<<"WRONG n="<<n<<" buffer "<<b<<endl;
+        }
+    }
+
+    for(int n : sizes){
+        int repeats = max(1,8000000/n);
+        vector<ListNode> pool(n);
+        mt19937 rng(n);
+
+        ListNode* head = build(pool,-1,rng);
+        double inPlace = rate([&](){ return s.isPalindromeInPlace(head); },1,repeats);
+        double readOnly = rate([&](){ return s.isPalindromeReadOnly(head,Solution::VERIFY_BUFFER); },1,repeats);
+        double shared = rate([&](){ return s.isPalindromeReadOnly(head,Solution::VERIFY_BUFFER); },threads,repeats);
+        cout<<"n = "<<n<<" palindrome, checks/s: in place "<<inPlace<<", read-only "<<readOnly
+            <<", read-only x"<<threads<<" threads "<<shared;
+        // a small buffer costs a walk to the mirror per chunk
+        if(n <= 100000){
+            cout<<", read-only with 1024-value buffer "
+                <<rate([&](){ return s.isPalindromeReadOnly(head,1024); },1,max(1,repeats/10));
+        }
+        cout<<endl;
+
+        head = build(pool,n/2-1,rng);
+        inPlace = rate([&](){ return !s.isPalindromeInPlace(head); },1,repeats);
+        readOnly = rate([&](){ return !s.isPalindromeReadOnly(head,Solution::VERIFY_BUFFER); },1,repeats);
+        shared = rate([&](){ return !s.isPalindromeReadOnly(head,Solution::VERIFY_BUFFER); },threads,repeats);
+        cout<<"n = "<<n<<" not a palindrome, checks/s: in place "<<inPlace<<", read-only "<<readOnly
+            <<", read-only x"<<threads<<" threads "<<shared<<endl;
+    }
+    return 0;
+}
@@ -1,6 +1,13 @@
 #include<iostream>
 #include<vector>
 #include<algorithm>
+#include<chrono>
+#include<cstdio>
+#include<fstream>
+#include<new>
+#include<random>
+#include<unistd.h>
+#include<sys/wait.h>
 using namespace std;
 
 class LinkedListNode{
@@ -14,14 +21,20 @@ class LinkedListNode{
     }
 };
 
+#include "NodePool.h"
+
+// one pool for every list in this file; like the list functions it is not
+// thread-safe, so only one thread may touch these lists at a time
+NodePool<LinkedListNode> nodePool;
+
 void insertAtHead(LinkedListNode* &head,int d){
-    LinkedListNode* temp = new LinkedListNode(d);
+    LinkedListNode* temp = nodePool.allocate(d);
     temp->next = head;
     head = temp;
 }
 
 void insertAtTail(LinkedListNode* &tail,int d){
-    LinkedListNode* temp = new LinkedListNode(d);
+    LinkedListNode* temp = nodePool.allocate(d);
     tail->next = temp;
     tail = tail->next;
 }
@@ -43,7 +56,7 @@ void insertAtMiddle(LinkedListNode* &tail,LinkedListNode* &head,int d,int n){
         insertAtTail(tail,d);
         return;
     }
-    LinkedListNode* newNode = new LinkedListNode(d);
+    LinkedListNode* newNode = nodePool.allocate(d);
     newNode->data = d;
     newNode->next = temp->next;
     temp->next = newNode;
@@ -57,7 +70,7 @@ void deleteNode(int n,LinkedListNode* &head,LinkedListNode* &tail){
         if(head == NULL)
             tail = NULL;
 
-        delete temp;
+        nodePool.release(temp);
         return;
     }
     LinkedListNode* curr = head;
@@ -72,7 +85,7 @@ void deleteNode(int n,LinkedListNode* &head,LinkedListNode* &tail){
     if(curr->next == NULL)
         tail = prev;
 
-    delete curr;
+    nodePool.release(curr);
 }
 
 void print(LinkedListNode* &head){
@@ -84,6 +97,13 @@ void print(LinkedListNode* &head){
     cout<<endl;
 }
 
+// O(1): hands every node back to the pool at once
+void deleteList(LinkedListNode* &head,LinkedListNode* &tail){
+    nodePool.releaseList(head,tail);
+    head = NULL;
+    tail = NULL;
+}
+
 int len(LinkedListNode* &head){
     int cnt = 0;
     LinkedListNode* temp = head;
@@ -94,10 +114,169 @@ int len(LinkedListNode* &head){
     return cnt;
 }
 
+// Copies the list into one contiguous run in list order and recycles the
+// old nodes, so a traversal afterwards walks memory sequentially. Slabs
+// left empty (such as the previous compaction's run) go back to the system,
+// so repeated compactions do not grow the pool.
+// Node addresses change: pointers held outside the list are invalidated.
+void compact(LinkedListNode* &head,LinkedListNode* &tail){
+    int n = len(head);
+    if(n == 0) return;
+
+    LinkedListNode* run = nodePool.allocateRun(n);
+    LinkedListNode* temp = head;
+    for(int i=0;i<n;i++){
+        new(run+i) LinkedListNode(temp->data);
+        if(i > 0) run[i-1].next = run+i;
+        temp = temp->next;
+    }
+
+    nodePool.releaseList(head,tail);
+    nodePool.trim();
+    head = run;
+    tail = run + n - 1;
+}
+
+long rssKB(){
+    long pages = 0, resident = 0;
+    ifstream statm("/proc/self/statm");
+    statm>>pages>>resident;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// keeps ~1M nodes alive while inserting at head/tail and deleting the head;
+// each variant runs in a forked child so its RSS is not inflated by the
+// other's heap, and the pool also reports the bytes it holds itself
+void churnBenchmark(){
+    const int live = 1000000;
+    const int ops = 20000000;
+
+    cout<<"Churn with "<<live<<" live nodes, "<<ops<<" insert+delete pairs"<<endl;
+    for(int pooled=0;pooled<2;pooled++){
+        pid_t child = fork();
+        if(child == -1){
+            perror("fork");
+            return;
+        }
+        if(child != 0){
+            waitpid(child,NULL,0);
+            continue;
+        }
+
+        long baseRss = rssKB();
+        auto start = chrono::high_resolution_clock::now();
+        long rss;
+        if(!pooled){
+            LinkedListNode* head = new LinkedListNode(0);
+            LinkedListNode* tail = head;
+            for(int i=1;i<live;i++){
+                LinkedListNode* temp = new LinkedListNode(i);
+                tail->next = temp;
+                tail = temp;
+            }
+            for(int i=0;i<ops;i++){
+                LinkedListNode* temp = new LinkedListNode(i);
+                if(i & 1){
+                    temp->next = head;
+                    head = temp;
+                }
+                else{
+                    tail->next = temp;
+                    tail = temp;
+                }
+                LinkedListNode* old = head;
+                head = head->next;
+                delete old;
+            }
+            rss = rssKB();
+            while(head){
+                LinkedListNode* next = head->next;
+                delete head;
+                head = next;
+            }
+        }
+        else{
+            LinkedListNode* head = nodePool.allocate(0);
+            LinkedListNode* tail = head;
+            for(int i=1;i<live;i++){
+                insertAtTail(tail,i);
+            }
+            for(int i=0;i<ops;i++){
+                if(i & 1){
+                    insertAtHead(head,i);
+                }
+                else{
+                    insertAtTail(tail,i);
+                }
+                deleteNode(1,head,tail);
+            }
+            rss = rssKB();
+            deleteList(head,tail);
+        }
+        auto end = chrono::high_resolution_clock::now();
+
+        double sec = chrono::duration<double>(end-start).count();
+        cout<<(pooled ? "slab pool : " : "new/delete: ")<<(2.0*ops/sec)/1e6<<" Mops/s, RSS +"<<(rss-baseRss)/1024<<" MB";
+        if(pooled) cout<<", pool holds "<<nodePool.bytes/(1024*1024)<<" MB";
+        cout<<endl;
+        _exit(0);
+    }
+}
+
+// a list whose nodes sit in random memory order, as after long churn
+void compactBenchmark(){
+    const int n = 2000000;
+    const int rounds = 10;
+
+    vector<LinkedListNode*> nodes(n);
+    for(int i=0;i<n;i++){
+        nodes[i] = nodePool.allocate(i);
+    }
+    shuffle(nodes.begin(),nodes.end(),mt19937(1));
+    for(int i=0;i+1<n;i++){
+        nodes[i]->next = nodes[i+1];
+    }
+    LinkedListNode* head = nodes[0];
+    LinkedListNode* tail = nodes[n-1];
+    nodes.clear();
+
+    long long sum = 0;
+    auto t0 = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        for(LinkedListNode* temp = head; temp; temp = temp->next) sum += temp->data;
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    compact(head,tail);
+    auto t2 = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        for(LinkedListNode* temp = head; temp; temp = temp->next) sum -= temp->data;
+    }
+    auto t3 = chrono::high_resolution_clock::now();
+
+    cout<<"Traversal of "<<n<<" scattered nodes"<<(sum ? " (MISMATCH)" : "")<<endl;
+    cout<<"before compact: "<<chrono::duration<double,milli>(t1-t0).count()/rounds<<" ms/pass"<<endl;
+    cout<<"compact       : "<<chrono::duration<double,milli>(t2-t1).count()<<" ms"<<endl;
+    cout<<"after compact : "<<chrono::duration<double,milli>(t3-t2).count()/rounds<<" ms/pass"<<endl;
+
+    // a little churn between compactions, then compact again: the pool
+    // should keep about one run's worth of memory, not one per compaction
+    size_t afterFirst = nodePool.bytes;
+    for(int r=0;r<5;r++){
+        for(int i=0;i<1000;i++){
+            insertAtHead(head,i);
+            deleteNode(2,head,tail);
+        }
+        compact(head,tail);
+    }
+    size_t slack = 2 * NodePool<LinkedListNode>::SLAB_SIZE * sizeof(LinkedListNode);
+    cout<<"pool after 1st compact "<<afterFirst/1024<<" KB, after 5 more "<<nodePool.bytes/1024<<" KB"
+        <<(nodePool.bytes > afterFirst + slack ? "  GROWING" : "")<<endl;
+    deleteList(head,tail);
+}
 
 int main(){
 
-    LinkedListNode* node = new LinkedListNode(10);
+    LinkedListNode* node = nodePool.allocate(10);
     // cout<<node->data<<endl;
     // cout<<node->next<<endl;
 
@@ -127,5 +306,11 @@ int main(){
     print(head);
     // cout<<head->data<<endl;
     // cout<<tail->data<<endl;
+    deleteList(head,tail);
+
+    cout<<"---------------"<<endl;
+    churnBenchmark();
+    cout<<"---------------"<<endl;
+    compactBenchmark();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,323 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<cstdlib>
+#include<chrono>
+#include<random>
+using namespace std;
+
+// Doubly linked list that keeps its size, tail and middle node up to date
+// on every insert and delete, so size(), back() and middle() are O(1)
+// instead of a walk (len() in DoublyLinkedList.cpp, slow/fast pointers in
+// MiddleOfLinkedList.cpp). middle() is the node middleNode returns: the
+// second of the two middles when the size is even.
+// An insert or delete moves the middle by at most one position, so one
+// step along next or prev puts it back. Positional operations also start
+// walking from whichever of head, middle or tail is closest.
+// Positions are 1-based like DoublyLinkedList.cpp.
+
+class TrackedNode{
+    public:
+        int data;
+        TrackedNode* prev;
+        TrackedNode* next;
+
+    TrackedNode(int d){
+        this->data = d;
+        this->prev = NULL;
+        this->next = NULL;
+    }
+};
+
+class TrackedList{
+    public:
+        TrackedNode* head;
+        TrackedNode* tail;
+        TrackedNode* mid;
+        int count;
+        int midPos;
+
+    TrackedList(){
+        head = tail = mid = NULL;
+        count = 0;
+        midPos = 0;
+    }
+
+    ~TrackedList(){
+        while(head){
+            TrackedNode* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    int size(){
+        return count;
+    }
+
+    int front(){
+        return head->data;
+    }
+
+    int back(){
+        return tail->data;
+    }
+
+    TrackedNode* middle(){
+        return mid;
+    }
+
+    void insertAtHead(int d){
+        insertAt(1,d);
+    }
+
+    void insertAtTail(int d){
+        insertAt(count+1,d);
+    }
+
+    // n in [1, size+1]
+    void insertAt(int n,int d){
+        if(n < 1 || n > count+1) return;
+
+        TrackedNode* node = new TrackedNode(d);
+        TrackedNode* after = (n == count+1) ? NULL : locate(n);
+        TrackedNode* before = after ? after->prev : tail;
+
+        node->prev = before;
+        node->next = after;
+        if(before) before->next = node;
+        else head = node;
+        if(after) after->prev = node;
+        else tail = node;
+
+        count++;
+        if(mid == NULL){
+            mid = node;
+            midPos = 1;
+        }
+        else if(n <= midPos){
+            midPos++;
+        }
+        recenter();
+    }
+
+    // pos in [1, size]
+    void deleteNode(int pos){
+        if(pos < 1 || pos > count) return;
+
+        TrackedNode* node = locate(pos);
+        if(node == mid){
+            // the next node slides into this position; with none, step back
+            if(mid->next) mid = mid->next;
+            else{
+                mid = mid->prev;
+                midPos--;
+            }
+        }
+        else if(pos < midPos){
+            midPos--;
+        }
+
+        if(node->prev) node->prev->next = node->next;
+        else head = node->next;
+        if(node->next) node->next->prev = node->prev;
+        else tail = node->prev;
+        delete node;
+
+        count--;
+        recenter();
+    }
+
+    void popFront(){
+        deleteNode(1);
+    }
+
+    void popBack(){
+        deleteNode(count);
+    }
+
+    void print(){
+        for(TrackedNode* temp = head; temp; temp = temp->next){
+            cout<<temp->data<<" ";
+        }
+        cout<<endl;
+    }
+
+    private:
+    // the middle of count nodes sits at count/2 + 1
+    void recenter(){
+        if(count == 0){
+            mid = NULL;
+            midPos = 0;
+            return;
+        }
+        int target = count/2 + 1;
+        while(midPos < target){
+            mid = mid->next;
+            midPos++;
+        }
+        while(midPos > target){
+            mid = mid->prev;
+            midPos--;
+        }
+    }
+
+    TrackedNode* locate(int pos){
+        TrackedNode* curr;
+        int at;
+        if(pos <= midPos/2){
+            curr = head;
+            at = 1;
+        }
+        else if(pos <= (midPos + count)/2){
+            curr = mid;
+            at = midPos;
+        }
+        else{
+            curr = tail;
+            at = count;
+        }
+        while(at < pos){
+            curr = curr->next;
+            at++;
+        }
+        while(at > pos){
+            curr = curr->prev;
+            at--;
+        }
+        return curr;
+    }
+};
+
+// the current functions from DoublyLinkedList.cpp and MiddleOfLinkedList.cpp,
+// on plain new/delete nodes like TrackedList uses
+void insertAtHead(TrackedNode* &head,TrackedNode* &tail,int d){
+    TrackedNode* newNode = new TrackedNode(d);
+    if(head == NULL){
+        head = tail = newNode;
+        return;
+    }
+    newNode->next = head;
+    head->prev = newNode;
+    head = newNode;
+}
+
+void insertAtTail(TrackedNode* &tail,TrackedNode* &head,int d){
+    TrackedNode* newNode = new TrackedNode(d);
+    if(tail == NULL){
+        head = tail = newNode;
+        return;
+    }
+    tail->next = newNode;
+    newNode->prev = tail;
+    tail = newNode;
+}
+
+void deleteHead(TrackedNode* &head,TrackedNode* &tail){
+    TrackedNode* temp = head;
+    head = head->next;
+    if(head != NULL) head->prev = NULL;
+    else tail = NULL;
+    delete temp;
+}
+
+int len(TrackedNode* head){
+    int cnt = 0;
+    for(; head; head = head->next) cnt++;
+    return cnt;
+}
+
+TrackedNode* middleNode(TrackedNode* head){
+    TrackedNode* slow = head;
+    TrackedNode* fast = head;
+    while(fast && fast->next){
+        slow = slow->next;
+        fast = fast->next->next;
+    }
+    return slow;
+}
+
+int main(int argc,char** argv){
+
+    TrackedList list;
+    list.insertAtHead(11);
+    list.insertAtHead(10);
+    list.insertAtTail(13);
+    list.insertAt(3,12);
+    list.print();
+    cout<<"size "<<list.size()<<", back "<<list.back()<<", middle "<<list.middle()->data<<endl;
+    list.deleteNode(1);
+    list.popBack();
+    list.insertAtTail(14);
+    list.insertAtTail(15);
+    list.print();
+    cout<<"size "<<list.size()<<", back "<<list.back()<<", middle "<<list.middle()->data<<endl;
+
+    // random operations against a vector
+    mt19937 rng(6);
+    TrackedList checked;
+    vector<int> model;
+    bool ok = true;
+    for(int i=0;i<200000 && ok;i++){
+        if(model.empty() || rng() % 5 < 3){
+            int pos = 1 + rng() % (model.size()+1);
+            checked.insertAt(pos,i);
+            model.insert(model.begin()+pos-1,i);
+        }
+        else{
+            int pos = 1 + rng() % model.size();
+            checked.deleteNode(pos);
+            model.erase(model.begin()+pos-1);
+        }
+        if(model.size() > 2000){
+            checked.popFront();
+            model.erase(model.begin());
+        }
+        ok = checked.size() == (int)model.size();
+        if(ok && !model.empty()){
+            ok = checked.back() == model.back() && checked.front() == model.front()
+                && checked.middle()->data == model[model.size()/2];
+        }
+    }
+    cout<<"random checks: "<<(ok ? "ok" : "FAILED")<<endl;
+    cout<<"---------------"<<endl;
+
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    const int queries = 100;
+
+    // queue-like churn: push at the tail, pop at the head
+    auto t0 = chrono::high_resolution_clock::now();
+    TrackedNode* head = NULL;
+    TrackedNode* tail = NULL;
+    for(int i=0;i<n;i++) insertAtTail(tail,head,i);
+    for(int i=0;i<n;i++){
+        insertAtTail(tail,head,i);
+        deleteHead(head,tail);
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    TrackedList tracked;
+    for(int i=0;i<n;i++) tracked.insertAtTail(i);
+    for(int i=0;i<n;i++){
+        tracked.insertAtTail(i);
+        tracked.popFront();
+    }
+    auto t2 = chrono::high_resolution_clock::now();
+
+    long long sum = 0;
+    for(int q=0;q<queries;q++) sum += len(head) + middleNode(head)->data;
+    auto t3 = chrono::high_resolution_clock::now();
+    for(int q=0;q<queries;q++) sum -= tracked.size() + tracked.middle()->data;
+    auto t4 = chrono::high_resolution_clock::now();
+
+    cout<<n<<" nodes, insert/delete ns/op: plain "<<chrono::duration<double,nano>(t1-t0).count()/(3*n)
+        <<", tracked "<<chrono::duration<double,nano>(t2-t1).count()/(3*n)<<endl;
+    cout<<"size + middle query us: walking "<<chrono::duration<double,micro>(t3-t2).count()/queries
+        <<", tracked "<<chrono::duration<double,micro>(t4-t3).count()/queries<<(sum ? "  WRONG" : "")<<endl;
+
+    while(head){
+        TrackedNode* next = head->next;
+        delete head;
+        head = next;
+    }
+    return 0;
+}
@@ -0,0 +1,247 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<cstring>
+#include<cstdlib>
+#include<chrono>
+#include<random>
+using namespace std;
+
+// Unrolled linked list: every node is one 64-byte cache line holding up to
+// CAP ints plus a count. Positional operations walk block by block, skipping
+// `count` elements per hop, and only shift ints inside a single block.
+// Same 1-based positional API as SinglyLinkedList.cpp.
+
+// next (8) + count (4) + 13 ints (52) = 64 bytes, aligned to the line
+class alignas(64) Block{
+    public:
+        static constexpr int CAP = 13;
+        Block* next;
+        int count;
+        int data[CAP];
+
+    Block(){
+        this->next = NULL;
+        this->count = 0;
+    }
+};
+
+static_assert(sizeof(Block) == 64, "Block should fill exactly one cache line");
+
+class UnrolledLinkedList{
+    public:
+        Block* head;
+        Block* tail;
+        int size;
+
+    UnrolledLinkedList(){
+        head = new Block();
+        tail = head;
+        size = 0;
+    }
+
+    ~UnrolledLinkedList(){
+        while(head){
+            Block* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    void insertAtHead(int d){
+        insertAtMiddle(d,1);
+    }
+
+    void insertAtTail(int d){
+        if(tail->count == Block::CAP){
+            split(tail);
+        }
+        tail->data[tail->count++] = d;
+        size++;
+    }
+
+    // n in [1, size+1]
+    void insertAtMiddle(int d,int n){
+        if(n < 1 || n > size+1) return;
+        if(n == size+1){
+            insertAtTail(d);
+            return;
+        }
+
+        int pos = n-1;
+        Block* blk = head;
+        while(pos > blk->count){
+            pos -= blk->count;
+            blk = blk->next;
+        }
+
+        if(blk->count == Block::CAP){
+            split(blk);
+            if(pos > blk->count){
+                pos -= blk->count;
+                blk = blk->next;
+            }
+        }
+        memmove(blk->data+pos+1,blk->data+pos,(blk->count-pos)*sizeof(int));
+        blk->data[pos] = d;
+        blk->count++;
+        size++;
+    }
+
+    // n in [1, size]
+    void deleteNode(int n){
+        if(n < 1 || n > size) return;
+
+        int pos = n-1;
+        Block* prev = NULL;
+        Block* blk = head;
+        while(pos >= blk->count){
+            pos -= blk->count;
+            prev = blk;
+            blk = blk->next;
+        }
+
+        memmove(blk->data+pos,blk->data+pos+1,(blk->count-pos-1)*sizeof(int));
+        blk->count--;
+        size--;
+
+        if(blk->count == 0 && blk != head){
+            unlink(prev,blk);
+        }
+        else if(blk->count < Block::CAP/2 && blk->next){
+            rebalance(blk);
+        }
+    }
+
+    // n in [1, size]; returns false and leaves value alone outside it
+    bool get(int n,int &value){
+        if(n < 1 || n > size) return false;
+        int pos = n-1;
+        Block* blk = head;
+        while(pos >= blk->count){
+            pos -= blk->count;
+            blk = blk->next;
+        }
+        value = blk->data[pos];
+        return true;
+    }
+
+    int len(){
+        return size;
+    }
+
+    void print(){
+        for(Block* blk = head; blk; blk = blk->next){
+            for(int i=0;i<blk->count;i++){
+                cout<<blk->data[i]<<" ";
+            }
+        }
+        cout<<endl;
+    }
+
+    private:
+    // moves the upper half of a full block into a new block after it
+    void split(Block* blk){
+        Block* temp = new Block();
+        int half = blk->count/2;
+        temp->count = blk->count - half;
+        memcpy(temp->data,blk->data+half,temp->count*sizeof(int));
+        blk->count = half;
+
+        temp->next = blk->next;
+        blk->next = temp;
+        if(tail == blk) tail = temp;
+    }
+
+    void unlink(Block* prev,Block* blk){
+        prev->next = blk->next;
+        if(tail == blk) tail = prev;
+        delete blk;
+    }
+
+    // merge with the next block if both fit, otherwise borrow from it
+    void rebalance(Block* blk){
+        Block* next = blk->next;
+        if(blk->count + next->count <= Block::CAP){
+            memcpy(blk->data+blk->count,next->data,next->count*sizeof(int));
+            blk->count += next->count;
+            unlink(blk,next);
+            return;
+        }
+        int move = (next->count - blk->count)/2;
+        memcpy(blk->data+blk->count,next->data,move*sizeof(int));
+        blk->count += move;
+        memmove(next->data,next->data+move,(next->count-move)*sizeof(int));
+        next->count -= move;
+    }
+};
+
+#include "ListBaselines.h"
+
+void benchmark(int n,int ops){
+    mt19937 rng(7);
+
+    // shuffled allocation order so the plain list is not laid out sequentially
+    vector<LinkedListNode*> nodes(n);
+    for(int i=0;i<n;i++) nodes[i] = new LinkedListNode(i);
+    shuffle(nodes.begin(),nodes.end(),rng);
+    for(int i=0;i+1<n;i++) nodes[i]->next = nodes[i+1];
+    LinkedListNode* head = nodes[0];
+    nodes.clear();
+    nodes.shrink_to_fit();
+
+    UnrolledLinkedList list;
+    for(int i=0;i<n;i++) list.insertAtTail(i);
+
+    vector<int> positions(ops);
+    for(int i=0;i<ops;i++) positions[i] = rng() % (n-1) + 1;
+
+    auto t0 = chrono::high_resolution_clock::now();
+    for(int i=0;i<ops;i++){
+        insertAt(head,i,positions[i]);
+        deleteAt(head,positions[(i*7)%ops]);
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    for(int i=0;i<ops;i++){
+        list.insertAtMiddle(i,positions[i]);
+        list.deleteNode(positions[(i*7)%ops]);
+    }
+    auto t2 = chrono::high_resolution_clock::now();
+
+    cout<<"n = "<<n<<": singly "<<chrono::duration<double,micro>(t1-t0).count()/(2*ops)<<" us/op"
+        <<", unrolled "<<chrono::duration<double,micro>(t2-t1).count()/(2*ops)<<" us/op"
+        <<" ("<<ops<<" insert+delete pairs at random positions)"<<endl;
+
+    deleteAll(head);
+}
+
+int main(int argc,char** argv){
+
+    UnrolledLinkedList list;
+    for(int i=1;i<=30;i++){
+        list.insertAtTail(i*10);
+    }
+    list.insertAtHead(5);
+    list.insertAtMiddle(15,3);
+    list.insertAtMiddle(999,20);
+    list.print();
+    list.deleteNode(1);
+    list.deleteNode(20);
+    list.deleteNode(list.len());
+    list.print();
+    int value = 0;
+    cout<<"len: "<<list.len();
+    if(list.get(10,value)) cout<<", 10th: "<<value;
+    cout<<", 0th present: "<<list.get(0,value)<<endl;
+    cout<<"---------------"<<endl;
+
+    // pass sizes on the command line, e.g. ./a.out 1000000 10000000 100000000
+    vector<int> sizes;
+    for(int i=1;i<argc;i++) sizes.push_back(atoi(argv[i]));
+    if(sizes.empty()) sizes = {1000000, 10000000};
+
+    for(int n : sizes){
+        benchmark(n,max(4,20000000/n));
+    }
+    return 0;
+}
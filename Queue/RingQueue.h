@@ -0,0 +1,116 @@
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+// Growable FIFO queue on a power-of-two circular array.
+// Same push/pop/front/empty/size interface as std::queue, but the buffer
+// only ever grows (doubling) and clear() keeps it, so a queue reused across
+// traversals stops allocating once it has seen the widest level.
+// pop(), front() and back() on an empty queue throw out_of_range, and a
+// capacity that would overflow throws length_error.
+
+template<typename T>
+class RingQueue{
+        T* arr;
+        size_t head;
+        size_t count;
+        size_t cap;
+
+    public:
+    RingQueue(size_t initial = 16){
+        cap = 1;
+        while(cap < initial){
+            cap = doubled(cap);
+        }
+        arr = new T[cap];
+        head = 0;
+        count = 0;
+    }
+
+    ~RingQueue(){
+        delete[] arr;
+    }
+
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+
+    void push(const T &val){
+        if(count == cap){
+            grow();
+        }
+        arr[(head + count) & (cap - 1)] = val;
+        count++;
+    }
+
+    void pop(){
+        if(count == 0){
+            throw std::out_of_range("RingQueue::pop on empty queue");
+        }
+        head = (head + 1) & (cap - 1);
+        count--;
+    }
+
+    T& front(){
+        if(count == 0){
+            throw std::out_of_range("RingQueue::front on empty queue");
+        }
+        return arr[head];
+    }
+
+    T& back(){
+        if(count == 0){
+            throw std::out_of_range("RingQueue::back on empty queue");
+        }
+        return arr[(head + count - 1) & (cap - 1)];
+    }
+
+    bool empty() const{
+        return count == 0;
+    }
+
+    size_t size() const{
+        return count;
+    }
+
+    size_t capacity() const{
+        return cap;
+    }
+
+    // drops the elements, keeps the buffer
+    void clear(){
+        head = 0;
+        count = 0;
+    }
+
+    void reserve(size_t n){
+        while(cap < n){
+            grow();
+        }
+    }
+
+    private:
+    static size_t doubled(size_t n){
+        if(n > (size_t)-1 / 2 / sizeof(T)){
+            throw std::length_error("RingQueue capacity overflow");
+        }
+        return n * 2;
+    }
+
+    void grow(){
+        size_t newCap = doubled(cap);
+        T* bigger = new T[newCap];
+        // the two runs, head..end of buffer and then the wrapped part
+        size_t first = cap - head < count ? cap - head : count;
+        std::copy(arr + head, arr + head + first, bigger);
+        std::copy(arr, arr + (count - first), bigger + first);
+        delete[] arr;
+        arr = bigger;
+        cap = newCap;
+        head = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,132 @@
+#include<iostream>
+#include<queue>
+#include<vector>
+#include<chrono>
+#include<cstdlib>
+#include<new>
+#include "RingQueue.h"
+using namespace std;
+
+// Compares BFS on std::queue (std::deque chunks) against RingQueue:
+// heap allocations per traversal and total time. The traversals in BST/ and
+// Tree/ take a caller-owned queue (or keep one in their Solution), which is
+// the reused case; a fresh RingQueue per traversal is timed for contrast.
+
+long long allocations = 0;
+
+void* operator new(size_t size){
+    allocations++;
+    void* p = malloc(size);
+    if(p == NULL) throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept{
+    free(p);
+}
+
+void operator delete(void* p,size_t) noexcept{
+    free(p);
+}
+
+class Node{
+    public:
+        int data;
+        Node* left;
+        Node* right;
+    Node(int data){
+        this->data = data;
+        this->left = NULL;
+        this->right = NULL;
+    }
+};
+
+// nodes live in one vector so building the tree does not skew the counts
+Node* buildComplete(vector<Node> &pool,int n){
+    pool.reserve(n);
+    for(int i=0;i<n;i++){
+        pool.push_back(Node(i));
+    }
+    for(int i=0;i<n;i++){
+        if(2*i+1 < n) pool[i].left = &pool[2*i+1];
+        if(2*i+2 < n) pool[i].right = &pool[2*i+2];
+    }
+    return &pool[0];
+}
+
+long long bfsStd(Node* root){
+    long long sum = 0;
+    queue<Node*> q;
+    q.push(root);
+    while(!q.empty()){
+        Node* front = q.front();
+        q.pop();
+        sum += front->data;
+        if(front->left) q.push(front->left);
+        if(front->right) q.push(front->right);
+    }
+    return sum;
+}
+
+long long bfsRing(Node* root,RingQueue<Node*> &q){
+    long long sum = 0;
+    q.clear();
+    q.push(root);
+    while(!q.empty()){
+        Node* front = q.front();
+        q.pop();
+        sum += front->data;
+        if(front->left) q.push(front->left);
+        if(front->right) q.push(front->right);
+    }
+    return sum;
+}
+
+int main(){
+
+    int sizes[] = {1000, 100000, 1000000};
+
+    for(int n : sizes){
+        vector<Node> pool;
+        Node* root = buildComplete(pool,n);
+        int rounds = 20000000 / n;
+
+        long long check = 0;
+
+        long long before = allocations;
+        auto start = chrono::high_resolution_clock::now();
+        for(int r=0;r<rounds;r++){
+            check += bfsStd(root);
+        }
+        auto mid = chrono::high_resolution_clock::now();
+        long long stdAllocs = allocations - before;
+
+        RingQueue<Node*> q;
+        before = allocations;
+        auto mid2 = chrono::high_resolution_clock::now();
+        for(int r=0;r<rounds;r++){
+            check -= bfsRing(root,q);
+        }
+        auto end = chrono::high_resolution_clock::now();
+        long long ringAllocs = allocations - before;
+
+        long long expected = bfsStd(root);
+        before = allocations;
+        auto end2 = chrono::high_resolution_clock::now();
+        for(int r=0;r<rounds;r++){
+            RingQueue<Node*> fresh;
+            if(bfsRing(root,fresh) != expected) check++;
+        }
+        auto end3 = chrono::high_resolution_clock::now();
+        long long freshAllocs = allocations - before;
+
+        cout<<"n = "<<n<<", "<<rounds<<" traversals"<<(check ? " (MISMATCH)" : "")<<endl;
+        cout<<"  std::queue : "<<chrono::duration<double,milli>(mid-start).count()<<" ms, "
+            <<(double)stdAllocs/rounds<<" allocations/traversal"<<endl;
+        cout<<"  RingQueue  : "<<chrono::duration<double,milli>(end-mid2).count()<<" ms, "
+            <<(double)ringAllocs/rounds<<" allocations/traversal (reused, capacity "<<q.capacity()<<")"<<endl;
+        cout<<"  RingQueue  : "<<chrono::duration<double,milli>(end3-end2).count()<<" ms, "
+            <<(double)freshAllocs/rounds<<" allocations/traversal (new per traversal)"<<endl;
+    }
+    return 0;
+}
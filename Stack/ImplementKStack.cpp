@@ -1,49 +1,63 @@
+// k stacks sharing one pool of slots: every slot holds a value and the
+// index of the slot below it (or of the next free slot), so the stacks and
+// the free list are all singly linked lists threaded through `next`.
+// Slots live in chunks of CHUNK; when the free list runs dry a new chunk is
+// added and chained onto it, so pushes never fail and no element ever
+// moves. Slot i is chunk i >> CHUNK_BITS, offset i & (CHUNK-1).
 class kStacks {
 
-    // main array to store elements
-    int *arr;
+    static constexpr int CHUNK_BITS = 10;
+    static constexpr int CHUNK = 1 << CHUNK_BITS;
+
+    // chunks of values and of next links
+    vector<int*> arr;
+    vector<int*> next;
     int *top;
-    int *next;
-    
+
     int n,s;
-    
+
     int freeSpot;
 
   public:
     kStacks(int n, int s) {
         // initialize data structures for k stacks
-        this->n = n;
+        this->n = 0;
         this->s = s;
-        arr = new int[n];
         top = new int[s];
-        next = new int[n];
-        
+
         for(int i=0;i<s;i++){
             top[i]=-1;
         }
-        for(int i=0;i<n;i++){
-            next[i]=i+1;
+        freeSpot = -1;
+        while(this->n < n){
+            grow();
         }
-        next[n-1] = -1;
-        
-        freeSpot = 0;
+    }
+
+    kStacks(const kStacks&) = delete;
+    kStacks& operator=(const kStacks&) = delete;
+
+    ~kStacks() {
+        for(int* chunk : arr) delete[] chunk;
+        for(int* chunk : next) delete[] chunk;
+        delete[] top;
     }
 
     void push(int x, int i) {
         // push element x into stack i
-        
+
         if(i < 0 || i >= s) return;
 
-        if(freeSpot == -1) return;
-        
+        if(freeSpot == -1) grow();
+
         int index = freeSpot;
-        
-        freeSpot = next[index];
-        
-        arr[index] = x;
-        
-        next[index] = top[i];
-        
+
+        freeSpot = link(index);
+
+        value(index) = x;
+
+        link(index) = top[i];
+
         top[i] =index;
     }
 
@@ -54,15 +68,191 @@ class kStacks {
         if(top[i] == -1){
             return -1;
         }
-        
+
         int index = top[i];
-        
-        top[i] = next[index];
-        
-        next[index] = freeSpot;
-        
+
+        top[i] = link(index);
+
+        link(index) = freeSpot;
+
         freeSpot = index;
-        
-        return arr[index];
+
+        return value(index);
+    }
+
+    int capacity() {
+        return n;
+    }
+
+  private:
+    int& value(int index) {
+        return arr[index >> CHUNK_BITS][index & (CHUNK-1)];
+    }
+
+    int& link(int index) {
+        return next[index >> CHUNK_BITS][index & (CHUNK-1)];
+    }
+
+    // a new chunk's slots go in front of the free list, in order
+    void grow() {
+        arr.push_back(new int[CHUNK]);
+        next.push_back(new int[CHUNK]);
+        for(int i=0;i<CHUNK-1;i++){
+            next.back()[i] = n+i+1;
+        }
+        next.back()[CHUNK-1] = freeSpot;
+        freeSpot = n;
+        n += CHUNK;
+    }
+};
+
+// The same layout made safe for concurrent push and pop from any thread,
+// without locks. Each stack top and the free list head is one 64-bit word:
+// the slot index in the low half and a tag, bumped on every change, in the
+// high half. A compare-and-swap that raced with a pop and re-push of the
+// same slot (ABA) then fails on the tag instead of linking a stale `next`.
+// Chunk pointers sit in a fixed directory of MAX_CHUNKS entries, so finding
+// a slot never takes a lock either; a chunk is published in the directory
+// before any of its slots reach the free list. Growing threads claim
+// directory entries with compare-and-swap, so two threads that find the
+// free list empty at once both add a chunk, and the count never passes
+// MAX_CHUNKS.
+class ConcurrentKStacks {
+
+    static constexpr int CHUNK_BITS = 10;
+    static constexpr int CHUNK = 1 << CHUNK_BITS;
+    static constexpr int MAX_CHUNKS = 1 << 16;
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    struct Slot {
+        atomic<int> value;
+        atomic<uint32_t> next;
+    };
+
+    // one per stack, on its own cache line
+    struct alignas(64) Top {
+        atomic<uint64_t> head;
+    };
+
+    atomic<Slot*> *chunks;
+    atomic<int> chunkCount;
+    Top *top;
+    atomic<uint64_t> freeHead;
+    int s;
+
+  public:
+    ConcurrentKStacks(int n, int s) {
+        this->s = s;
+        chunks = new atomic<Slot*>[MAX_CHUNKS];
+        for(int c=0;c<MAX_CHUNKS;c++) chunks[c].store(NULL);
+        chunkCount.store(0);
+        top = new Top[s];
+        for(int i=0;i<s;i++) top[i].head.store(pack(NONE,0));
+        freeHead.store(pack(NONE,0));
+        while(chunkCount.load()*CHUNK < n){
+            grow();
+        }
+    }
+
+    ConcurrentKStacks(const ConcurrentKStacks&) = delete;
+    ConcurrentKStacks& operator=(const ConcurrentKStacks&) = delete;
+
+    // only safe once no other thread uses the stacks
+    ~ConcurrentKStacks() {
+        for(int c=0;c<chunkCount.load();c++) delete[] chunks[c].load();
+        delete[] chunks;
+        delete[] top;
+    }
+
+    // false only when MAX_CHUNKS chunks are in use and all slots are taken
+    bool push(int x, int i) {
+        if(i < 0 || i >= s) return false;
+
+        uint32_t index;
+        while((index = take(freeHead)) == NONE){
+            if(!grow()) return false;
+        }
+        slot(index).value.store(x, memory_order_relaxed);
+        put(top[i].head, index);
+        return true;
+    }
+
+    // -1 when stack i is empty, like kStacks
+    int pop(int i) {
+        if(i < 0 || i >= s) return -1;
+
+        uint32_t index = take(top[i].head);
+        if(index == NONE) return -1;
+        int x = slot(index).value.load(memory_order_relaxed);
+        put(freeHead, index);
+        return x;
+    }
+
+    int capacity() {
+        return chunkCount.load() * CHUNK;
+    }
+
+  private:
+    static uint64_t pack(uint32_t index, uint32_t tag) {
+        return ((uint64_t)tag << 32) | index;
+    }
+
+    static uint32_t indexOf(uint64_t word) {
+        return (uint32_t)word;
+    }
+
+    static uint32_t tagOf(uint64_t word) {
+        return (uint32_t)(word >> 32);
+    }
+
+    Slot& slot(uint32_t index) {
+        return chunks[index >> CHUNK_BITS].load(memory_order_acquire)[index & (CHUNK-1)];
+    }
+
+    // Treiber push of one slot onto a stack or the free list
+    void put(atomic<uint64_t> &head, uint32_t index) {
+        uint64_t old = head.load(memory_order_relaxed);
+        do {
+            slot(index).next.store(indexOf(old), memory_order_relaxed);
+        } while(!head.compare_exchange_weak(old, pack(index, tagOf(old)+1),
+                                            memory_order_release, memory_order_relaxed));
+    }
+
+    // Treiber pop; reading `next` of a slot another thread has just taken
+    // is harmless, the tag makes the swap fail
+    uint32_t take(atomic<uint64_t> &head) {
+        uint64_t old = head.load(memory_order_acquire);
+        while(indexOf(old) != NONE){
+            uint32_t below = slot(indexOf(old)).next.load(memory_order_relaxed);
+            if(head.compare_exchange_weak(old, pack(below, tagOf(old)+1),
+                                          memory_order_acquire, memory_order_acquire)){
+                return indexOf(old);
+            }
+        }
+        return NONE;
+    }
+
+    // claims the next directory entry, publishes a new chunk there, then
+    // hands its slots to the free list as one pre-linked chain; once the
+    // directory is full the count stays at MAX_CHUNKS
+    bool grow() {
+        int c = chunkCount.load();
+        do {
+            if(c >= MAX_CHUNKS) return false;
+        } while(!chunkCount.compare_exchange_weak(c, c+1));
+
+        Slot* chunk = new Slot[CHUNK];
+        uint32_t first = (uint32_t)c << CHUNK_BITS;
+        for(int i=0;i<CHUNK-1;i++){
+            chunk[i].next.store(first+i+1, memory_order_relaxed);
+        }
+        chunks[c].store(chunk, memory_order_release);
+
+        uint64_t old = freeHead.load(memory_order_relaxed);
+        do {
+            chunk[CHUNK-1].next.store(indexOf(old), memory_order_relaxed);
+        } while(!freeHead.compare_exchange_weak(old, pack(first, tagOf(old)+1),
+                                                memory_order_release, memory_order_relaxed));
+        return true;
     }
-};
\ No newline at end of file
+};
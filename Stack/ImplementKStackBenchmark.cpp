@@ -0,0 +1,124 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<atomic>
+#include<thread>
+#include<mutex>
+#include<chrono>
+#include<random>
+#include<cstdint>
+using namespace std;
+
+#include "ImplementKStack.cpp"
+
+// Push/pop throughput of ConcurrentKStacks against kStacks behind one
+// mutex, with every thread on its own stack and with all threads on one
+// stack, plus a check that concurrent pushes and pops lose nothing.
+
+class LockedKStacks {
+    kStacks stacks;
+    mutex m;
+
+  public:
+    LockedKStacks(int n, int s) : stacks(n, s) {}
+
+    bool push(int x, int i) {
+        lock_guard<mutex> lock(m);
+        stacks.push(x, i);
+        return true;
+    }
+
+    int pop(int i) {
+        lock_guard<mutex> lock(m);
+        return stacks.pop(i);
+    }
+};
+
+// each thread pushes a burst of values and pops them again
+template<typename Stacks>
+double throughput(int threads, bool shared, int opsPerThread) {
+    Stacks stacks(1024, threads);
+    atomic<long long> sum(0);
+    vector<thread> pool;
+    auto start = chrono::high_resolution_clock::now();
+    for(int t=0;t<threads;t++){
+        pool.push_back(thread([&stacks,&sum,t,shared,opsPerThread](){
+            int i = shared ? 0 : t;
+            long long local = 0;
+            for(int done=0;done<opsPerThread;done+=32){
+                for(int j=0;j<16;j++) stacks.push(j, i);
+                for(int j=0;j<16;j++) local += stacks.pop(i);
+            }
+            sum += local;
+        }));
+    }
+    for(thread &th : pool) th.join();
+    auto end = chrono::high_resolution_clock::now();
+    if(sum.load() < -(long long)threads*opsPerThread) cout<<"unreachable"<<endl;
+    return threads * (double)opsPerThread / chrono::duration<double>(end-start).count() / 1e6;
+}
+
+int main() {
+
+    // the constructor rounds 3 slots up to one chunk, so grow() only runs
+    // once more than a chunk's worth is pushed; every value pushed before
+    // each growth must still pop back in LIFO order afterwards
+    {
+        kStacks single(3, 2);
+        int before = single.capacity();    // one chunk
+        const int pushes = 3*before + 5;
+        for(int x=1;x<=pushes;x++) single.push(x, x % 2);
+        bool ok = true;
+        for(int i=0;i<2;i++){
+            int expected = pushes % 2 == i ? pushes : pushes - 1;
+            for(;expected >= 1;expected -= 2) ok = ok && single.pop(i) == expected;
+            ok = ok && single.pop(i) == -1;
+        }
+        cout<<"grow check: "<<(ok ? "ok" : "FAILED")<<", capacity "<<before<<" -> "<<single.capacity()<<endl;
+    }
+
+    // threads push distinct values onto 4 shared stacks, popping some as
+    // they go; the values left plus those popped must be every value once
+    {
+        const int threads = 8;
+        const int perThread = 20000;
+        ConcurrentKStacks stacks(16, 4);
+        vector<vector<int>> popped(threads);
+        vector<thread> pool;
+        for(int t=0;t<threads;t++){
+            pool.push_back(thread([&stacks,&popped,t](){
+                mt19937 rng(t);
+                for(int j=0;j<perThread;j++){
+                    stacks.push(t*perThread + j, rng() % 4);
+                    if(j % 3 == 0){
+                        int x = stacks.pop(rng() % 4);
+                        if(x != -1) popped[t].push_back(x);
+                    }
+                }
+            }));
+        }
+        for(thread &th : pool) th.join();
+
+        vector<int> all;
+        for(auto &p : popped) all.insert(all.end(), p.begin(), p.end());
+        for(int i=0;i<4;i++){
+            int x;
+            while((x = stacks.pop(i)) != -1) all.push_back(x);
+        }
+        sort(all.begin(), all.end());
+        bool ok = (int)all.size() == threads*perThread;
+        for(int i=0;ok && i<(int)all.size();i++) ok = all[i] == i;
+        cout<<"concurrent push/pop check: "<<(ok ? "ok" : "FAILED")<<", capacity "<<stacks.capacity()<<endl;
+    }
+    cout<<"---------------"<<endl;
+
+    int threadCounts[] = {1, 2, 4, 8};
+    cout<<"Mops/s"<<endl;
+    for(int threads : threadCounts){
+        cout<<threads<<" threads, own stacks: lock-free "<<throughput<ConcurrentKStacks>(threads, false, 400000)
+            <<", mutex "<<throughput<LockedKStacks>(threads, false, 400000)
+            <<" | one shared stack: lock-free "<<throughput<ConcurrentKStacks>(threads, true, 400000)
+            <<", mutex "<<throughput<LockedKStacks>(threads, true, 400000)<<endl;
+    }
+    return 0;
+}
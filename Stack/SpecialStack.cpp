@@ -1,25 +1,107 @@
+// Stack that keeps, next to every element, the aggregate of that element
+// and everything below it under an associative operator, so the aggregate
+// of the whole stack is always the top entry: O(1) push, pop and
+// aggregate() for min, max, sum, gcd, or, and, ...
+// By default a new element combines as op(below, x); with prepend set it
+// combines as op(x, below), which the front stack of AggregateQueue needs
+// for operators that do not commute.
+struct MinOp {
+    template<typename T> T operator()(const T &a, const T &b) const { return min(a, b); }
+};
+
+struct MaxOp {
+    template<typename T> T operator()(const T &a, const T &b) const { return max(a, b); }
+};
+
+struct GcdOp {
+    template<typename T> T operator()(const T &a, const T &b) const { return gcd(a, b); }
+};
+
+// plus<>, bit_or<> and bit_and<> from <functional> work as they are
+
+template<typename T, typename Op>
+class AggregateStack {
+    vector<pair<T,T>> items;    // element, aggregate up to it
+    Op op;
+    bool prepend;
+
+  public:
+    AggregateStack(bool prepend = false, Op op = Op()) {
+        this->prepend = prepend;
+        this->op = op;
+    }
+
+    void push(const T &x) {
+        if(items.empty()) items.push_back({x, x});
+        else if(prepend) items.push_back({x, op(x, items.back().second)});
+        else items.push_back({x, op(items.back().second, x)});
+    }
+
+    // the pops and reads expect a non-empty stack
+    T pop() {
+        T x = items.back().first;
+        items.pop_back();
+        return x;
+    }
+
+    const T& top() { return items.back().first; }
+    const T& aggregate() { return items.back().second; }
+    bool empty() { return items.empty(); }
+    int size() { return items.size(); }
+};
+
+// FIFO queue out of two aggregate stacks: push onto `back`, pop from
+// `front`, and when `front` runs dry move everything across, which
+// reverses it into pop order. Each element crosses once, so push, pop and
+// aggregate() are O(1) amortized; aggregate() of a sliding window is a
+// push of the new value, a pop of the expired one, and one op.
+template<typename T, typename Op>
+class AggregateQueue {
+    AggregateStack<T,Op> front;
+    AggregateStack<T,Op> back;
+    Op op;
+
+  public:
+    AggregateQueue(Op op = Op()) : front(true, op), back(false, op) {
+        this->op = op;
+    }
+
+    void push(const T &x) {
+        back.push(x);
+    }
+
+    // expects a non-empty queue
+    T pop() {
+        if(front.empty()){
+            while(!back.empty()) front.push(back.pop());
+        }
+        return front.pop();
+    }
+
+    // oldest to newest: op(front aggregate, back aggregate)
+    T aggregate() {
+        if(front.empty()) return back.aggregate();
+        if(back.empty()) return front.aggregate();
+        return op(front.aggregate(), back.aggregate());
+    }
+
+    bool empty() { return front.empty() && back.empty(); }
+    int size() { return front.size() + back.size(); }
+};
+
 class SpecialStack {
   public:
-    stack<int> st;
-    stack<int> gmin;
-    
+    AggregateStack<int,MinOp> st;
+
     SpecialStack(){}
 
     void push(int x) {
         st.push(x);
-
-        if (gmin.empty() || x <= gmin.top()) {
-            gmin.push(x);
-        }
     }
 
     void pop() {
         // Remove the top element from the Stack
         if (st.empty()) return;
-
-        if (st.top() == gmin.top()) {
-            gmin.pop();
-        }
         st.pop();
     }
 
@@ -33,7 +115,7 @@ class SpecialStack {
     }
 
     int getMin() {
-        if (gmin.empty()) return -1;
-        return gmin.top();
+        if (st.empty()) return -1;
+        return st.aggregate();
     }
-};
\ No newline at end of file
+};
@@ -0,0 +1,87 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<functional>
+#include<numeric>
+#include<chrono>
+#include<random>
+#include<cstdint>
+#include<climits>
+using namespace std;
+
+#include "SpecialStack.cpp"
+
+// Sliding-window aggregates over a stream: AggregateQueue (one push, one
+// pop, one op per window) against recomputing every window from scratch.
+// Recomputing is only timed on as many windows as fit a fixed work budget.
+
+template<typename Op>
+void benchmark(const char* name, const vector<long long> &stream, int w, long long identity) {
+    Op op;
+    int windows = stream.size() - w + 1;
+
+    long long fastSum = 0;
+    auto t0 = chrono::high_resolution_clock::now();
+    AggregateQueue<long long,Op> q;
+    for(int i=0;i<(int)stream.size();i++){
+        q.push(stream[i]);
+        if(i >= w) q.pop();
+        if(i >= w-1) fastSum += q.aggregate();
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+
+    int sampled = min(windows, max(1, 50000000 / w));
+    long long slowSum = 0, fastSample = 0;
+    AggregateQueue<long long,Op> check;
+    auto t2 = chrono::high_resolution_clock::now();
+    for(int s=0;s<sampled;s++){
+        long long acc = identity;
+        for(int i=s;i<s+w;i++) acc = op(acc, stream[i]);
+        slowSum += acc;
+    }
+    auto t3 = chrono::high_resolution_clock::now();
+    for(int i=0;i<sampled+w-1;i++){
+        check.push(stream[i]);
+        if(i >= w) check.pop();
+        if(i >= w-1) fastSample += check.aggregate();
+    }
+
+    cout<<name<<", window "<<w<<": queue "<<chrono::duration<double,nano>(t1-t0).count()/windows
+        <<" ns/window, recompute "<<chrono::duration<double,nano>(t3-t2).count()/sampled<<" ns/window"
+        <<(slowSum == fastSample ? "" : "  WRONG")<<endl;
+    if(fastSum == LLONG_MIN) cout<<"unreachable"<<endl;
+}
+
+int main() {
+
+    SpecialStack s;
+    int values[] = {18, 19, 29, 15, 16};
+    for(int x : values) s.push(x);
+    cout<<"min "<<s.getMin();
+    s.pop();
+    s.pop();
+    cout<<", after two pops "<<s.getMin()<<endl;
+
+    AggregateQueue<int,GcdOp> g;
+    int gs[] = {12, 18, 24, 7};
+    for(int x : gs) g.push(x);
+    cout<<"gcd(12,18,24,7) "<<g.aggregate();
+    g.pop();
+    g.pop();
+    g.pop();
+    cout<<", gcd(7) "<<g.aggregate()<<endl;
+    cout<<"---------------"<<endl;
+
+    mt19937 rng(8);
+    vector<long long> stream(4000000);
+    for(long long &x : stream) x = 1 + rng() % 1000000;
+
+    int widths[] = {16, 1024, 65536};
+    for(int w : widths){
+        benchmark<MinOp>("min", stream, w, LLONG_MAX);
+        benchmark<plus<>>("sum", stream, w, 0);
+        benchmark<GcdOp>("gcd", stream, w, 0);
+        benchmark<bit_or<>>("or ", stream, w, 0);
+    }
+    return 0;
+}
@@ -1,3 +1,7 @@
+// Array stack that doubles when full instead of dropping pushes. pushN and
+// popN move whole blocks with one memcpy and one capacity check instead of
+// a branch per element; reserve() sizes the array up front. The stack owns
+// its array, so it cannot be copied.
 class myStack {
   public:
     int *arr;
@@ -10,25 +14,77 @@ class myStack {
         top = -1;
     }
 
+    myStack(const myStack&) = delete;
+    myStack& operator=(const myStack&) = delete;
+
+    ~myStack() {
+        delete[] arr;
+    }
+
     bool isEmpty() {
         // check if the stack is empty
         return top == -1;
     }
 
     bool isFull() {
-        // check if the stack is full
+        // check if the stack is full (the next push grows it)
         return top == n - 1;
     }
 
+    int size() {
+        return top + 1;
+    }
+
+    // room for at least m elements without growing
+    void reserve(int m) {
+        if (m <= n) return;
+        int *bigger = new int[m];
+        memcpy(bigger, arr, size() * sizeof(int));
+        delete[] arr;
+        arr = bigger;
+        n = m;
+    }
+
     void push(int x) {
         // inserts x at the top of the stack
         if (isFull()) {
-            // cout << "Stack is FULL, Can't add new element\n";
-            return;
+            reserve(max(2 * n, 1));
         }
         arr[++top] = x;
     }
 
+    // pushes values[0..count) in order, values[count-1] ends on top; a
+    // count below 1 pushes nothing. values may point into this stack
+    // (pushN(arr, size()) doubles it): on growth they are copied into the
+    // new array before the old one is freed.
+    void pushN(const int *values, int count) {
+        if (count <= 0) return;
+        if (size() + count > n) {
+            int m = max(2 * n, size() + count);
+            int *bigger = new int[m];
+            memcpy(bigger, arr, size() * sizeof(int));
+            memcpy(bigger + size(), values, count * sizeof(int));
+            delete[] arr;
+            arr = bigger;
+            n = m;
+        }
+        else {
+            memmove(arr + top + 1, values, count * sizeof(int));
+        }
+        top += count;
+    }
+
+    // removes up to count elements and returns how many (0 for a count
+    // below 1). They land in out in stack order, bottom first, so
+    // out[popped-1] is the old top.
+    int popN(int *out, int count) {
+        if (count <= 0) return 0;
+        count = min(count, size());
+        top -= count;
+        memcpy(out, arr + top + 1, count * sizeof(int));
+        return count;
+    }
+
     void pop() {
         // removes an element from the top of the stack
         if (isEmpty()) {
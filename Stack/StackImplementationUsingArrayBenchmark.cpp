@@ -0,0 +1,79 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<chrono>
+#include<cstring>
+using namespace std;
+
+#include "StackImplementationUsingArray.cpp"
+
+// Per-element cost of moving ints through a warm myStack one at a time
+// (push/peek/pop) against pushN/popN in blocks of several sizes, and the
+// cost of filling a fresh stack by growing against reserve().
+
+// total elements pushed and popped `rounds` times through one stack
+double nsPerElement(myStack &st, int total, int rounds, int batch, long long &check) {
+    vector<int> in(max(batch, 1)), out(max(batch, 1));
+    for(int i=0;i<(int)in.size();i++) in[i] = i;
+
+    auto start = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        if(batch == 0){
+            for(int i=0;i<total;i++) st.push(i);
+            while(!st.isEmpty()){
+                check += st.peek();
+                st.pop();
+            }
+        }
+        else{
+            for(int done=0;done<total;done+=batch) st.pushN(in.data(), min(batch, total-done));
+            int got;
+            while((got = st.popN(out.data(), batch)) > 0){
+                for(int i=0;i<got;i++) check += out[i];
+            }
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+    return chrono::duration<double,nano>(end-start).count() / (2.0 * total * rounds);
+}
+
+int main() {
+
+    myStack st(2);
+    int values[] = {1, 2, 3, 4, 5};
+    st.push(0);
+    st.pushN(values, 5);                 // grows past 2
+    int out[3];
+    int got = st.popN(out, 3);
+    cout<<"popped "<<got<<": "<<out[0]<<" "<<out[1]<<" "<<out[2]<<", top "<<st.peek()<<", size "<<st.size()<<endl;
+    st.pushN(st.arr, st.size());         // its own contents: fits
+    st.pushN(st.arr, st.size());         // and again: grows past 6
+    cout<<"doubled twice: size "<<st.size()<<", bottom-up";
+    for(int i=0;i<st.size();i++) cout<<" "<<st.arr[i];
+    cout<<", popN(-1) "<<st.popN(out, -1)<<endl;
+    cout<<"---------------"<<endl;
+
+    const int total = 1000000;
+    const int rounds = 20;
+    int batches[] = {0, 16, 256, 4096};
+    long long check = 0;
+    for(int batch : batches){
+        myStack warm(total);
+        nsPerElement(warm, total, 1, batch, check);
+        cout<<(batch == 0 ? string("single push/pop") : "batches of " + to_string(batch))
+            <<": "<<nsPerElement(warm, total, rounds, batch, check)<<" ns/element"<<endl;
+    }
+
+    for(int reserved=0;reserved<2;reserved++){
+        auto start = chrono::high_resolution_clock::now();
+        myStack fresh(1);
+        if(reserved) fresh.reserve(total);
+        for(int i=0;i<total;i++) fresh.push(i);
+        auto end = chrono::high_resolution_clock::now();
+        check += fresh.peek();
+        cout<<"fill "<<total<<" from empty, "<<(reserved ? "reserved: " : "growing : ")
+            <<chrono::duration<double,nano>(end-start).count()/total<<" ns/element"<<endl;
+    }
+    if(check == 0) cout<<"unreachable"<<endl;
+    return 0;
+}
@@ -1,53 +1,159 @@
+// Two stacks growing toward each other in one buffer: stack 1 from the
+// front, stack 2 from the back. When the tops meet the buffer doubles and
+// both halves are moved (copied only if T's move may throw) to the two ends
+// of the new one, so no push is ever dropped. As in std::vector, the pushed
+// element is built in the new buffer before anything is relocated, so
+// arguments referring into the stack (push1(top1())) stay valid, and a
+// throwing copy leaves the stack as it was.
+template<typename T>
+class TwoEndedStack {
+    T *buf;
+    int cap;
+    int n1;     // stack 1 is buf[0, n1)
+    int n2;     // stack 2 is buf[cap-n2, cap)
+
+  public:
+    TwoEndedStack(int capacity = 16) {
+        cap = max(capacity, 2);
+        buf = allocator<T>().allocate(cap);
+        n1 = n2 = 0;
+    }
+
+    TwoEndedStack(const TwoEndedStack&) = delete;
+    TwoEndedStack& operator=(const TwoEndedStack&) = delete;
+
+    ~TwoEndedStack() {
+        destroy(buf, buf+n1);
+        destroy(buf+cap-n2, buf+cap);
+        allocator<T>().deallocate(buf, cap);
+    }
+
+    void push1(const T &x) { emplace1(x); }
+    void push1(T &&x) { emplace1(std::move(x)); }
+    void push2(const T &x) { emplace2(x); }
+    void push2(T &&x) { emplace2(std::move(x)); }
+
+    template<typename... Args>
+    void emplace1(Args&&... args) {
+        if(n1 + n2 == cap) {
+            growWith(true, std::forward<Args>(args)...);
+            return;
+        }
+        new(buf+n1) T(std::forward<Args>(args)...);
+        n1++;
+    }
+
+    template<typename... Args>
+    void emplace2(Args&&... args) {
+        if(n1 + n2 == cap) {
+            growWith(false, std::forward<Args>(args)...);
+            return;
+        }
+        new(buf+cap-n2-1) T(std::forward<Args>(args)...);
+        n2++;
+    }
+
+    // the pops and tops expect a non-empty stack
+    T pop1() {
+        T x = std::move(buf[--n1]);
+        buf[n1].~T();
+        return x;
+    }
+
+    T pop2() {
+        T x = std::move(buf[cap-n2]);
+        buf[cap-n2].~T();
+        n2--;
+        return x;
+    }
+
+    T& top1() { return buf[n1-1]; }
+    T& top2() { return buf[cap-n2]; }
+    int size1() { return n1; }
+    int size2() { return n2; }
+    bool empty1() { return n1 == 0; }
+    bool empty2() { return n2 == 0; }
+    int capacity() { return cap; }
+
+  private:
+    // moves or copies; leaves the source alive for the caller to destroy
+    static void relocate(T *from, T *to, int count) {
+        if constexpr (is_nothrow_move_constructible<T>::value || !is_copy_constructible<T>::value) {
+            uninitialized_move(from, from+count, to);
+        }
+        else {
+            uninitialized_copy(from, from+count, to);
+        }
+    }
+
+    // doubles the buffer with the new element pushed onto stack 1 (first)
+    // or stack 2; the old buffer is only torn down once everything is in
+    // the new one
+    template<typename... Args>
+    void growWith(bool first, Args&&... args) {
+        int bigger = cap * 2;
+        int m1 = n1 + (first ? 1 : 0);
+        int m2 = n2 + (first ? 0 : 1);
+        T *fresh = allocator<T>().allocate(bigger);
+        T *slot = first ? fresh+n1 : fresh+bigger-m2;
+        int built = 0;      // 1: new element, 2: and stack 1
+        try {
+            new(slot) T(std::forward<Args>(args)...);
+            built = 1;
+            relocate(buf, fresh, n1);
+            built = 2;
+            relocate(buf+cap-n2, fresh+bigger-n2, n2);
+        }
+        catch(...) {
+            if(built >= 2) destroy(fresh, fresh+n1);
+            if(built >= 1) slot->~T();
+            allocator<T>().deallocate(fresh, bigger);
+            throw;
+        }
+        destroy(buf, buf+n1);
+        destroy(buf+cap-n2, buf+cap);
+        allocator<T>().deallocate(buf, cap);
+        buf = fresh;
+        cap = bigger;
+        n1 = m1;
+        n2 = m2;
+    }
+};
+
 class twoStacks {
   public:
-    int *arr;
-    int top1;
-    int top2;
-    int size;
-    twoStacks() {
-        size = 100;
-        arr = new int[size];
-        top1 = -1;
-        top2 = size;
+    TwoEndedStack<int> stacks;
+    twoStacks() : stacks(100) {
     }
 
     // Function to push an integer into the stack1.
     void push1(int x) {
         // code here
-        if(top2-top1 > 1){
-            arr[++top1] = x;
-        }
-        
+        stacks.push1(x);
     }
 
     // Function to push an integer into the stack2.
     void push2(int x) {
         // code here
-        if(top2 - top1 >1){
-            arr[--top2] = x;
-        }
+        stacks.push2(x);
     }
 
     // Function to remove an element from top of the stack1.
-        
+
     int pop1() {
         // code here
-        if(top1 >= 0){
-            int ans = arr[top1];
-            top1--;
-            return ans;
+        if(!stacks.empty1()){
+            return stacks.pop1();
         }
         return -1;
     }
 
-        
+
     // Function to remove an element from top of the stack2.
     int pop2() {
         // code here
-        if(top2 < size){
-            int ans = arr[top2];
-            top2++;
-            return ans;
+        if(!stacks.empty2()){
+            return stacks.pop2();
         }
         return -1;
     }
@@ -0,0 +1,107 @@
+#include<iostream>
+#include<vector>
+#include<string>
+#include<memory>
+#include<algorithm>
+#include<type_traits>
+#include<chrono>
+#include<new>
+using namespace std;
+
+#include "TwoStack.cpp"
+
+// Push/pop throughput of TwoEndedStack against two std::vectors, for ints
+// and for strings (which must be moved, not copied, when the buffer grows),
+// plus a count of the copies each growth makes.
+
+// counts copy constructions; moves are free
+struct Tracked {
+    static long long copies;
+    string s;
+    Tracked(const string &s) : s(s) {}
+    Tracked(const Tracked &o) : s(o.s) { copies++; }
+    Tracked(Tracked &&o) noexcept : s(std::move(o.s)) {}
+};
+long long Tracked::copies = 0;
+
+// what each popped value adds to the check sum; both stacks hold the same
+// values, so the sum comes back to 0 only if every pop really ran
+long long weight(int x) { return x; }
+long long weight(const string &x) { return x.size() + x.back(); }
+
+template<typename T, typename Make>
+void benchmark(const char* name, int n, int rounds, Make make) {
+    vector<T> values;
+    for(int i=0;i<n;i++) values.push_back(make(i));
+
+    long long check = 0;
+    auto t0 = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        TwoEndedStack<T> both;
+        for(int i=0;i<n;i++){
+            both.push1(values[i]);
+            both.push2(values[n-1-i]);
+        }
+        while(!both.empty1()){
+            T a = both.pop1();
+            T b = both.pop2();
+            check += weight(a) - weight(b);
+        }
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+    for(int r=0;r<rounds;r++){
+        vector<T> first, second;
+        for(int i=0;i<n;i++){
+            first.push_back(values[i]);
+            second.push_back(values[n-1-i]);
+        }
+        while(!first.empty()){
+            T a = std::move(first.back());
+            first.pop_back();
+            T b = std::move(second.back());
+            second.pop_back();
+            check += weight(a) - weight(b);
+        }
+    }
+    auto t2 = chrono::high_resolution_clock::now();
+
+    double ops = 4.0 * n * rounds;
+    cout<<name<<", "<<n<<" per stack: two-ended "<<ops/chrono::duration<double>(t1-t0).count()/1e6
+        <<" Mops/s, two vectors "<<ops/chrono::duration<double>(t2-t1).count()/1e6<<" Mops/s"
+        <<(check ? "  WRONG" : "")<<endl;
+}
+
+int main() {
+
+    twoStacks s;
+    for(int i=0;i<150;i++){
+        s.push1(i);
+        s.push2(-i);
+    }
+    cout<<"pop1 "<<s.pop1()<<", pop2 "<<s.pop2()<<", capacity "<<s.stacks.capacity()<<endl;
+
+    TwoEndedStack<Tracked> tracked(2);
+    for(int i=0;i<1000;i++){
+        tracked.emplace1("left " + to_string(i));
+        tracked.emplace2("right " + to_string(i));
+    }
+    cout<<"copies while growing to "<<tracked.capacity()<<" slots: "<<Tracked::copies<<endl;
+    cout<<"top1 "<<tracked.top1().s<<", top2 "<<tracked.top2().s<<endl;
+
+    // pushing a stack's own top while the push has to grow it
+    TwoEndedStack<string> self(2);
+    self.push1("first");
+    self.push2("second");
+    self.push1(self.top1());
+    self.push2(self.top2());
+    cout<<"self-push: top1 "<<self.top1()<<", top2 "<<self.top2()<<endl;
+    cout<<"---------------"<<endl;
+
+    int sizes[] = {100, 10000, 1000000};
+    for(int n : sizes){
+        int rounds = max(1, 10000000/n);
+        benchmark<int>("int", n, rounds, [](int i){ return i; });
+        benchmark<string>("string", n, max(1, rounds/4), [](int i){ return "value number " + to_string(i); });
+    }
+    return 0;
+}
@@ -1,3 +1,4 @@
+#include "../Queue/RingQueue.h"
 /*
 class Node {
 public:
@@ -14,6 +15,9 @@ public:
 
 class Solution {
   public:
+    // reused across calls so the buffer is allocated once
+    RingQueue<pair<Node*,int>> q;
+
     vector<int> bottomView(Node *root) {
         // code here
     vector<int> ans;
@@ -23,7 +27,7 @@ class Solution {
     }
     
     map<int,int> bottomView;
-    queue<pair<Node*,int>> q;
+    q.clear();
     
     q.push({root,0});
     
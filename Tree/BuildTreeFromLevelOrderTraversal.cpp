@@ -1,5 +1,5 @@
 #include <bits/stdc++.h>
-#include <queue>
+#include "../Queue/RingQueue.h"
 using namespace std;
 
 #include <bits/stdc++.h>
@@ -35,8 +35,10 @@ Node* buildTree(Node* root){
     return root;
 }
 
-void levelOrderTraversal(Node* root){
-    queue<Node*> q;
+// q is owned by the caller and cleared here, so a queue passed to every
+// traversal keeps the capacity the widest level needed
+void levelOrderTraversal(Node* root,RingQueue<Node*> &q){
+    q.clear();
     q.push(root);
     q.push(NULL);
     
@@ -62,8 +64,8 @@ void levelOrderTraversal(Node* root){
     }
 }
 
-void buildFromLevelOrderTraversal(Node* &root){
-    queue<Node*> q;
+void buildFromLevelOrderTraversal(Node* &root,RingQueue<Node*> &q){
+    q.clear();
     cout<<"enter the value of root"<<endl;
     int data;
     cin>>data;
@@ -96,10 +98,10 @@ void buildFromLevelOrderTraversal(Node* &root){
     }
 }
 
-void reverseLevelOrderTraversal(Node* root){
+void reverseLevelOrderTraversal(Node* root,RingQueue<Node*> &q){
     if(root == NULL) return;
     
-    queue<Node*> q;
+    q.clear();
     stack<Node*> st;
     
     q.push(root);
@@ -125,12 +127,13 @@ void reverseLevelOrderTraversal(Node* root){
 
 int main() {
 	Node* root = NULL;
+	RingQueue<Node*> bfsQueue;     // shared by every traversal below
 // 	root = buildTree(root);
 	
-	buildFromLevelOrderTraversal(root);
-	levelOrderTraversal(root);
+	buildFromLevelOrderTraversal(root,bfsQueue);
+	levelOrderTraversal(root,bfsQueue);
 	
-// 	reverseLevelOrderTraversal(root);
+// 	reverseLevelOrderTraversal(root,bfsQueue);
 	
     return 0;
 }
@@ -1,5 +1,5 @@
 #include <bits/stdc++.h>
-#include <queue>
+#include "../Queue/RingQueue.h"
 using namespace std;
 
 #include <bits/stdc++.h>
@@ -35,8 +35,10 @@ Node* buildTree(Node* root){
     return root;
 }
 
-void levelOrderTraversal(Node* root){
-    queue<Node*> q;
+// q is owned by the caller and cleared here, so a queue passed to every
+// traversal keeps the capacity the widest level needed
+void levelOrderTraversal(Node* root,RingQueue<Node*> &q){
+    q.clear();
     q.push(root);
     q.push(NULL);
     
@@ -64,9 +66,10 @@ void levelOrderTraversal(Node* root){
 
 int main() {
 	Node* root = NULL;
+	RingQueue<Node*> bfsQueue;     // shared by every traversal below
 	root = buildTree(root);
 	
-	levelOrderTraversal(root);
+	levelOrderTraversal(root,bfsQueue);
 	
     return 0;
 }
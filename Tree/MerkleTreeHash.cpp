@@ -0,0 +1,285 @@
+#include<iostream>
+#include<vector>
+#include<unordered_map>
+#include<chrono>
+#include<cstdint>
+using namespace std;
+
+// Every node keeps a structural hash of its subtree (value + shape) and the
+// hash of its mirror image. Both are computed bottom-up once and refreshed
+// only along the path to the root when a node is edited, so comparing two
+// subtrees costs one hash comparison; the full node-by-node walk runs only
+// when the hashes agree.
+
+class Node{
+    public:
+        int data;
+        Node* left;
+        Node* right;
+        Node* parent;
+        uint64_t hash;
+        uint64_t mirrorHash;
+    Node(int data){
+        this->data = data;
+        this->left = NULL;
+        this->right = NULL;
+        this->parent = NULL;
+        this->hash = 0;
+        this->mirrorHash = 0;
+    }
+};
+
+const uint64_t NULL_HASH = 0x9e3779b97f4a7c15ULL;
+
+uint64_t mix(uint64_t x){
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// order of the children matters, so (a,b) and (b,a) hash differently
+uint64_t combine(int data,uint64_t l,uint64_t r){
+    uint64_t h = mix((uint64_t)(uint32_t)data + 0x632be59bd9b4e019ULL);
+    h = mix(h ^ (l + 0x9e3779b97f4a7c15ULL + (h<<6) + (h>>2)));
+    h = mix(h ^ (r + 0x8cb92ba72f3d8dd7ULL + (h<<6) + (h>>2)));
+    return h;
+}
+
+uint64_t hashOf(Node* root){
+    return root ? root->hash : NULL_HASH;
+}
+
+uint64_t mirrorOf(Node* root){
+    return root ? root->mirrorHash : NULL_HASH;
+}
+
+void refresh(Node* root){
+    root->hash = combine(root->data,hashOf(root->left),hashOf(root->right));
+    root->mirrorHash = combine(root->data,mirrorOf(root->right),mirrorOf(root->left));
+}
+
+// post order: children are hashed before their parent
+void computeHashes(Node* root){
+    if(root == NULL) return;
+
+    computeHashes(root->left);
+    computeHashes(root->right);
+    if(root->left) root->left->parent = root;
+    if(root->right) root->right->parent = root;
+    refresh(root);
+}
+
+// rehash from node up to the root: O(depth) per edit
+void updatePath(Node* node){
+    while(node){
+        refresh(node);
+        node = node->parent;
+    }
+}
+
+void setData(Node* node,int d){
+    node->data = d;
+    updatePath(node);
+}
+
+// replaces parent->left (or right) with child; returns the detached subtree
+Node* attachChild(Node* parent,Node* child,bool isLeft){
+    Node* old = isLeft ? parent->left : parent->right;
+    if(old) old->parent = NULL;
+
+    if(isLeft) parent->left = child;
+    else parent->right = child;
+
+    if(child){
+        if(child->parent){
+            if(child->parent->left == child) child->parent->left = NULL;
+            else child->parent->right = NULL;
+            updatePath(child->parent);
+        }
+        child->parent = parent;
+    }
+    updatePath(parent);
+    return old;
+}
+
+bool verifySame(Node* p,Node* q){
+    if(p==NULL && q==NULL){
+        return true;
+    }
+    if(p==NULL || q==NULL || p->data!=q->data){
+        return false;
+    }
+    return verifySame(p->left,q->left) && verifySame(p->right,q->right);
+}
+
+bool verifyMirror(Node* p,Node* q){
+    if(p == NULL && q == NULL){
+        return true;
+    }
+    if(p == NULL || q == NULL){
+        return false;
+    }
+    return p->data==q->data && verifyMirror(p->left,q->right) && verifyMirror(p->right,q->left);
+}
+
+bool isSameTree(Node* p,Node* q){
+    if(p == q) return true;
+    if(hashOf(p) != hashOf(q)) return false;
+    return verifySame(p,q);
+}
+
+bool isSymmetric(Node* root){
+    if(root == NULL) return true;
+    if(hashOf(root->left) != mirrorOf(root->right)) return false;
+    return verifyMirror(root->left,root->right);
+}
+
+void collect(Node* root,vector<Node*> &nodes){
+    if(root == NULL) return;
+    collect(root->left,nodes);
+    collect(root->right,nodes);
+    nodes.push_back(root);
+}
+
+// one representative per structure that appears more than once
+vector<Node*> findDuplicateSubtrees(Node* root){
+    vector<Node*> nodes;
+    collect(root,nodes);
+
+    unordered_map<uint64_t,vector<pair<Node*,int>>> seen;
+    vector<Node*> ans;
+
+    for(Node* node : nodes){
+        vector<pair<Node*,int>> &bucket = seen[node->hash];
+        bool found = false;
+        for(auto &entry : bucket){
+            if(verifySame(entry.first,node)){
+                entry.second++;
+                if(entry.second == 2){
+                    ans.push_back(entry.first);
+                }
+                found = true;
+                break;
+            }
+        }
+        if(!found){
+            bucket.push_back({node,1});
+        }
+    }
+    return ans;
+}
+
+Node* buildComplete(int depth,int &val){
+    if(depth == 0) return NULL;
+    Node* root = new Node(val++ % 7);
+    root->left = buildComplete(depth-1,val);
+    root->right = buildComplete(depth-1,val);
+    return root;
+}
+
+Node* buildMirror(Node* root){
+    if(root == NULL) return NULL;
+    Node* copy = new Node(root->data);
+    copy->left = buildMirror(root->right);
+    copy->right = buildMirror(root->left);
+    return copy;
+}
+
+Node* buildCopy(Node* root){
+    if(root == NULL) return NULL;
+    Node* copy = new Node(root->data);
+    copy->left = buildCopy(root->left);
+    copy->right = buildCopy(root->right);
+    return copy;
+}
+
+void deleteTree(Node* root){
+    if(root == NULL) return;
+    deleteTree(root->left);
+    deleteTree(root->right);
+    delete root;
+}
+
+int main(){
+
+    int val = 0;
+    Node* base = buildComplete(18,val);
+    computeHashes(base);
+
+    vector<Node*> candidates;
+    for(int i=0;i<16;i++){
+        Node* copy = buildCopy(base);
+        computeHashes(copy);
+        candidates.push_back(copy);
+    }
+    // make all but the first candidate differ in one deep leaf
+    for(int i=1;i<(int)candidates.size();i++){
+        Node* temp = candidates[i];
+        int step = 0;
+        while(temp->left){
+            temp = ((i>>step)&1) ? temp->left : temp->right;
+            step++;
+        }
+        setData(temp,temp->data+i);
+    }
+
+    int rounds = 50;
+
+    auto start = chrono::high_resolution_clock::now();
+    int plainMatches = 0;
+    for(int r=0;r<rounds;r++){
+        for(Node* c : candidates){
+            plainMatches += verifySame(base,c);
+        }
+    }
+    auto mid = chrono::high_resolution_clock::now();
+    int hashMatches = 0;
+    for(int r=0;r<rounds;r++){
+        for(Node* c : candidates){
+            hashMatches += isSameTree(base,c);
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+
+    cout<<"Same tree checks ("<<rounds*candidates.size()<<" comparisons, 2^18-1 nodes):"<<endl;
+    cout<<"node by node: "<<chrono::duration<double,milli>(mid-start).count()<<" ms, matches "<<plainMatches<<endl;
+    cout<<"hash first  : "<<chrono::duration<double,milli>(end-mid).count()<<" ms, matches "<<hashMatches<<endl;
+
+    // symmetric tree: root with a subtree and its mirror
+    Node* sym = new Node(1);
+    sym->left = buildCopy(base);
+    sym->right = buildMirror(base);
+    computeHashes(sym);
+    cout<<"\nSymmetric: "<<isSymmetric(sym)<<endl;
+
+    Node* leaf = sym->right;
+    while(leaf->right) leaf = leaf->right;
+    setData(leaf,leaf->data+1);
+    cout<<"After editing one leaf: "<<isSymmetric(sym)<<endl;
+    setData(leaf,leaf->data-1);
+    cout<<"After undoing the edit: "<<isSymmetric(sym)<<endl;
+
+    Node* small = new Node(1);
+    small->left = new Node(2);
+    small->right = new Node(3);
+    small->left->left = new Node(4);
+    small->right->left = new Node(2);
+    small->right->left->left = new Node(4);
+    small->right->right = new Node(4);
+    computeHashes(small);
+
+    cout<<"\nDuplicate subtrees roots: ";
+    for(Node* d : findDuplicateSubtrees(small)){
+        cout<<d->data<<" ";
+    }
+    cout<<endl;
+
+    deleteTree(base);
+    for(Node* c : candidates) deleteTree(c);
+    deleteTree(sym);
+    deleteTree(small);
+    return 0;
+}
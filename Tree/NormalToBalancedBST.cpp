@@ -1,3 +1,4 @@
+#include "../BST/TreeToVine.h"
 /*Structure of the Node of the BST is as
 class Node {
   public:
@@ -17,32 +18,45 @@ class Node {
 class Solution {
 
   public:
-    void inorder(Node* root, vector<int> &ans){
-        if(root == NULL) return;
-        
-        inorder(root->left,ans);
-        ans.push_back(root->data);
-        inorder(root->right,ans);
+    // count left rotations along the right spine, every other node
+    void compress(Node* pseudoRoot, int count){
+        Node* scanner = pseudoRoot;
+        for(int i=0;i<count;i++){
+            Node* child = scanner->right;
+            scanner->right = child->right;
+            scanner = scanner->right;
+            child->right = scanner->left;
+            scanner->left = child;
+        }
     }
     
-    Node* inorderToBST(int s, int e,vector<int> &ans){
-        if(s>e){
-            return NULL;
+    void vineToTree(Node* pseudoRoot, int size){
+        int full = 1;
+        while(full <= size + 1){
+            full *= 2;
         }
-        int mid = s+(e-s)/2;
-        
-        Node* root = new Node(ans[mid]);
-        root->left = inorderToBST(s,mid-1,ans);
-        root->right = inorderToBST(mid+1,e,ans);
+        full = full/2 - 1;
         
-        return root;
+        // extra nodes form the partial bottom level
+        compress(pseudoRoot, size - full);
+        size = full;
+        while(size > 1){
+            size /= 2;
+            compress(pseudoRoot, size);
+        }
     }
     
+    // Day-Stout-Warren: rotate into a right chain (vine) with treeToVine,
+    // then fold it back with left rotations. Works in place, O(1) extra
+    // memory, no allocation.
     Node* balanceBST(Node* root) {
         // Code here
-        vector<int> ans;
-        inorder(root,ans);
+        Node pseudoRoot(0);
+        pseudoRoot.right = root;
+        
+        int size = treeToVine(&pseudoRoot);
+        vineToTree(&pseudoRoot, size);
         
-        return inorderToBST(0,ans.size()-1,ans);
+        return pseudoRoot.right;
     }
 };
\ No newline at end of file
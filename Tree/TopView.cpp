@@ -1,3 +1,4 @@
+#include "../Queue/RingQueue.h"
 /*
 class Node {
   public:
@@ -15,6 +16,9 @@ class Node {
 
 class Solution {
   public:
+    // reused across calls so the buffer is allocated once
+    RingQueue<pair<Node*,int>> q;
+
     vector<int> topView(Node *root) {
         // code here
         vector<int> ans;
@@ -24,7 +28,7 @@ class Solution {
         }
         
         map<int,int> topView;
-        queue<pair<Node*,int>> q;
+        q.clear();
         
         q.push({root,0});
         
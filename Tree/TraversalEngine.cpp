@@ -0,0 +1,323 @@
+#include<iostream>
+#include<vector>
+#include<algorithm>
+#include<chrono>
+#include<random>
+using namespace std;
+
+// Pre/in/post order traversals without recursion and without growing a
+// vector<int> per call. Three strategies:
+//   STACK   - explicit stack kept by the engine and reused between calls
+//   MORRIS  - threads the tree through empty right pointers, O(1) extra
+//             space; the tree is restored before returning
+//   visit() - streams every node to a callback instead of a buffer
+// Buffer output goes into caller memory of a given capacity, which
+// countNodes() sizes exactly.
+
+class Node{
+    public:
+        int data;
+        Node* left;
+        Node* right;
+    Node(int data){
+        this->data = data;
+        this->left = NULL;
+        this->right = NULL;
+    }
+};
+
+enum Order { PREORDER, INORDER, POSTORDER };
+enum Strategy { STACK, MORRIS };
+
+class TraversalEngine{
+    public:
+        vector<Node*> st;
+        size_t peakStack;
+
+    TraversalEngine(){
+        peakStack = 0;
+    }
+
+    // Morris walk, so counting needs no extra memory either
+    static int countNodes(Node* root){
+        int cnt = 0;
+        morris(root,INORDER,[&cnt](Node*){ cnt++; });
+        return cnt;
+    }
+
+    template<typename Visit>
+    static void morris(Node* root,Order order,Visit visit){
+        if(order == POSTORDER){
+            morrisPost(root,visit);
+            return;
+        }
+        Node* curr = root;
+        while(curr){
+            if(curr->left == NULL){
+                visit(curr);
+                curr = curr->right;
+                continue;
+            }
+            Node* pred = curr->left;
+            while(pred->right && pred->right != curr){
+                pred = pred->right;
+            }
+            if(pred->right == NULL){
+                if(order == PREORDER) visit(curr);
+                pred->right = curr;
+                curr = curr->left;
+            }
+            else{
+                pred->right = NULL;
+                if(order == INORDER) visit(curr);
+                curr = curr->right;
+            }
+        }
+    }
+
+    template<typename Visit>
+    void stackWalk(Node* root,Order order,Visit visit){
+        st.clear();
+        if(root == NULL) return;
+
+        if(order == INORDER){
+            Node* curr = root;
+            while(curr || !st.empty()){
+                if(curr){
+                    push(curr);
+                    curr = curr->left;
+                }
+                else{
+                    curr = st.back();
+                    st.pop_back();
+                    visit(curr);
+                    curr = curr->right;
+                }
+            }
+        }
+        else if(order == PREORDER){
+            push(root);
+            while(!st.empty()){
+                Node* node = st.back();
+                st.pop_back();
+                visit(node);
+                if(node->right) push(node->right);
+                if(node->left) push(node->left);
+            }
+        }
+        else{
+            // a node is visited after both children, tracked by the last one emitted
+            Node* curr = root;
+            Node* last = NULL;
+            while(curr || !st.empty()){
+                if(curr){
+                    push(curr);
+                    curr = curr->left;
+                    continue;
+                }
+                Node* top = st.back();
+                if(top->right && top->right != last){
+                    curr = top->right;
+                }
+                else{
+                    visit(top);
+                    last = top;
+                    st.pop_back();
+                }
+            }
+        }
+    }
+
+    template<typename Visit>
+    void visit(Node* root,Order order,Strategy strategy,Visit f){
+        if(strategy == MORRIS) morris(root,order,f);
+        else stackWalk(root,order,f);
+    }
+
+    // Writes at most capacity ints into out and returns how many were
+    // written; size it with countNodes(root) to get the whole traversal.
+    // The walk still finishes past the bound so Morris restores the tree.
+    int traverse(Node* root,Order order,Strategy strategy,int* out,int capacity){
+        int i = 0;
+        visit(root,order,strategy,[out,capacity,&i](Node* node){
+            if(i < capacity) out[i++] = node->data;
+        });
+        return i;
+    }
+
+    private:
+    void push(Node* node){
+        st.push_back(node);
+        if(st.size() > peakStack) peakStack = st.size();
+    }
+
+    static Node* reverseRightChain(Node* from){
+        Node* prev = NULL;
+        while(from){
+            Node* next = from->right;
+            from->right = prev;
+            prev = from;
+            from = next;
+        }
+        return prev;
+    }
+
+    // emits the right chain from->...->to bottom-up, leaving it as it was
+    template<typename Visit>
+    static void visitReverse(Node* from,Node* to,Visit &visit){
+        Node* after = to->right;
+        to->right = NULL;
+        Node* tail = reverseRightChain(from);
+        Node* temp = tail;
+        while(temp){
+            visit(temp);
+            temp = temp->right;
+        }
+        reverseRightChain(tail);
+        to->right = after;
+    }
+
+    template<typename Visit>
+    static void morrisPost(Node* root,Visit &visit){
+        Node dummy(0);
+        dummy.left = root;
+        Node* curr = &dummy;
+        while(curr){
+            if(curr->left == NULL){
+                curr = curr->right;
+                continue;
+            }
+            Node* pred = curr->left;
+            while(pred->right && pred->right != curr){
+                pred = pred->right;
+            }
+            if(pred->right == NULL){
+                pred->right = curr;
+                curr = curr->left;
+            }
+            else{
+                pred->right = NULL;
+                visitReverse(curr->left,pred,visit);
+                curr = curr->right;
+            }
+        }
+    }
+};
+
+// the existing recursive versions, for comparison
+int maxDepthSeen = 0;
+
+void solve(Node* root,vector<int> &ans,Order order,int depth){
+    if(root == NULL) return;
+    maxDepthSeen = max(maxDepthSeen,depth);
+
+    if(order == PREORDER) ans.push_back(root->data);
+    solve(root->left,ans,order,depth+1);
+    if(order == INORDER) ans.push_back(root->data);
+    solve(root->right,ans,order,depth+1);
+    if(order == POSTORDER) ans.push_back(root->data);
+}
+
+Node* insertIntoBST(Node* root,int data){
+    Node* node = new Node(data);
+    if(root == NULL) return node;
+
+    Node* curr = root;
+    while(true){
+        Node* &next = data > curr->data ? curr->right : curr->left;
+        if(next == NULL){
+            next = node;
+            return root;
+        }
+        curr = next;
+    }
+}
+
+void deleteTree(Node* root){
+    TraversalEngine engine;
+    vector<Node*> nodes;
+    engine.visit(root,PREORDER,STACK,[&nodes](Node* node){ nodes.push_back(node); });
+    for(Node* node : nodes) delete node;
+}
+
+void benchmark(const char* name,Node* root){
+    int n = TraversalEngine::countNodes(root);
+    int* out = new int[n];
+    const char* orders[] = {"pre ", "in  ", "post"};
+
+    cout<<name<<" ("<<n<<" nodes)"<<endl;
+    for(int o=0;o<3;o++){
+        Order order = (Order)o;
+
+        maxDepthSeen = 0;
+        auto t0 = chrono::high_resolution_clock::now();
+        vector<int> ans;
+        solve(root,ans,order,1);
+        auto t1 = chrono::high_resolution_clock::now();
+
+        TraversalEngine engine;
+        engine.traverse(root,order,STACK,out,n);
+        auto t2 = chrono::high_resolution_clock::now();
+        bool stackOk = equal(ans.begin(),ans.end(),out);
+
+        engine.traverse(root,order,MORRIS,out,n);
+        auto t3 = chrono::high_resolution_clock::now();
+        bool morrisOk = equal(ans.begin(),ans.end(),out);
+
+        long long sum = 0;
+        engine.visit(root,order,MORRIS,[&sum](Node* node){ sum += node->data; });
+        auto t4 = chrono::high_resolution_clock::now();
+
+        cout<<"  "<<orders[o]
+            <<" | recursive "<<chrono::duration<double,milli>(t1-t0).count()<<" ms, "
+            <<ans.capacity()*sizeof(int)/1024<<" KB vector + depth "<<maxDepthSeen
+            <<" | stack "<<chrono::duration<double,milli>(t2-t1).count()<<" ms, "
+            <<engine.peakStack*sizeof(Node*)<<" B stack"
+            <<" | morris "<<chrono::duration<double,milli>(t3-t2).count()<<" ms, 0 B"
+            <<" | visitor "<<chrono::duration<double,milli>(t4-t3).count()<<" ms"
+            <<((stackOk && morrisOk) ? "" : "  MISMATCH")<<endl;
+    }
+    delete[] out;
+}
+
+int main(){
+
+    Node* small = NULL;
+    int vals[] = {50, 30, 70, 20, 40, 60, 80};
+    for(int v : vals) small = insertIntoBST(small,v);
+
+    int n = TraversalEngine::countNodes(small);
+    vector<int> buffer(n);
+    TraversalEngine engine;
+    const char* names[] = {"Preorder", "Inorder", "Postorder"};
+    for(int o=0;o<3;o++){
+        cout<<names[o]<<": ";
+        int written = engine.traverse(small,(Order)o,MORRIS,buffer.data(),n);
+        for(int i=0;i<written;i++) cout<<buffer[i]<<" ";
+        cout<<endl;
+    }
+    int firstThree[3];
+    int written = engine.traverse(small,INORDER,MORRIS,firstThree,3);
+    cout<<"Inorder, capacity 3: ";
+    for(int i=0;i<written;i++) cout<<firstThree[i]<<" ";
+    cout<<"(tree intact: "<<(TraversalEngine::countNodes(small) == n ? "yes" : "no")<<")"<<endl;
+    cout<<endl;
+
+    mt19937 rng(42);
+    Node* randomTree = NULL;
+    for(int i=0;i<1000000;i++){
+        randomTree = insertIntoBST(randomTree,rng());
+    }
+    benchmark("Random BST",randomTree);
+
+    Node* chain = NULL;
+    for(int i=0;i<20000;i++){
+        chain = insertIntoBST(chain,i);
+    }
+    benchmark("Right chain",chain);
+
+    deleteTree(small);
+    deleteTree(randomTree);
+    deleteTree(chain);
+    return 0;
+}
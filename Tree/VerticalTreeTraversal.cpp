@@ -1,3 +1,4 @@
+#include "../Queue/RingQueue.h"
 /*
 class Node {
   public:
@@ -15,12 +16,15 @@ class Node {
 
 class Solution {
   public:
+    // reused across calls so the buffer is allocated once
+    RingQueue<pair<Node*,pair<int,int>>> q;
+
     vector<vector<int>> verticalOrder(Node *root) {
         // code here
         vector<vector<int>> ans;
         
         map<int, map<int,vector<int>>> nodes;
-        queue<pair<Node*,pair<int,int>>> q;
+        q.clear();
         
         if(root==NULL){
             return ans;
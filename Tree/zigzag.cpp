@@ -1,3 +1,4 @@
+#include "../Queue/RingQueue.h"
 /**
  * Definition for a binary tree node.
  * struct TreeNode {
@@ -11,6 +12,9 @@
  */
 class Solution {
 public:
+    // reused across calls so the buffer is allocated once
+    RingQueue<TreeNode*> q;
+
     vector<vector<int>> zigzagLevelOrder(TreeNode* root) {
         vector<vector<int>> ans;
 
@@ -18,7 +22,7 @@ public:
             return ans;
         }
         
-        queue<TreeNode*> q;
+        q.clear();
         q.push(root);
 
         bool LtoR = true;